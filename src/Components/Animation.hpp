@@ -31,6 +31,7 @@ struct TweenAnimation {
     float endY = 0.0f;              // 结束Y坐标
     EasingType easing = EasingType::Linear;
     bool finished = false;          // 是否完成
+    uint32_t group = 0;             // 动画组ID（0 表示不属于任何组）
     
     TweenAnimation() = default;
     TweenAnimation(float duration, float startX, float startY, 
@@ -60,6 +61,7 @@ struct ScaleAnimation {
     float endScale = 0.0f;
     EasingType easing = EasingType::Linear;
     bool finished = false;
+    uint32_t group = 0;
     
     ScaleAnimation() = default;
     ScaleAnimation(float duration, float startScale, float endScale,
@@ -86,6 +88,7 @@ struct FadeAnimation {
     float endAlpha = 0.0f;          // 结束透明度 [0, 1]
     EasingType easing = EasingType::Linear;
     bool finished = false;
+    uint32_t group = 0;
     
     FadeAnimation() = default;
     FadeAnimation(float duration, float startAlpha, float endAlpha,
@@ -112,6 +115,7 @@ struct RotationAnimation {
     float endRotation = 0.0f;       // 结束旋转角度（弧度）
     EasingType easing = EasingType::Linear;
     bool finished = false;
+    uint32_t group = 0;
     
     RotationAnimation() = default;
     RotationAnimation(float duration, float startRotation, float endRotation,
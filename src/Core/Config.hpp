@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace Match3
@@ -14,6 +15,30 @@ namespace Match3
         inline constexpr int WINDOW_HEIGHT = 600;
         inline constexpr auto WINDOW_TITLE = "Match-3 Game";
 
+        // 逻辑更新
+        inline constexpr float TARGET_FPS = 60.0f; // 逻辑更新频率
+        inline constexpr float FIXED_TIMESTEP = 1.0f / TARGET_FPS; // 固定时间步长（秒）
+        inline constexpr int IDLE_WAIT_TIMEOUT_MS = 100; // 损伤跟踪模式下空闲帧等待事件的超时（毫秒）
+        inline constexpr uint64_t ASSET_UPLOAD_BUDGET_NS = 4'000'000; // 每帧用于完成异步资源加载的时间预算（纳秒）
+
+        // 纹理内存预算（字节），超出后按最近最少使用淘汰可重新加载的纹理
+#ifdef __ANDROID__
+        inline constexpr size_t TEXTURE_BUDGET_BYTES = 48ull * 1024 * 1024;
+#else
+        inline constexpr size_t TEXTURE_BUDGET_BYTES = 256ull * 1024 * 1024;
+#endif
+
+        // 渲染预算：超出的帧每秒汇总告警一次（0 表示不检查该项）
+        inline constexpr int RENDER_BUDGET_DRAW_CALLS = 150;         // 每帧 SDL 绘制调用
+        inline constexpr int RENDER_BUDGET_TEXT_RASTERISATIONS = 4;  // 每帧整串文字光栅化
+        inline constexpr int RENDER_BUDGET_TEXTURES_CREATED = 8;     // 每帧新建纹理
+        inline constexpr float RENDER_BUDGET_MS = 8.0f;              // 每帧渲染 CPU 耗时（毫秒）
+
+        // 资源路径
+        inline constexpr auto UI_FONT_PATH = "resources/fonts/ZCOOLKuaiLe-Regular.ttf";
+        inline constexpr auto UI_BAKED_FONT_PATH = "resources/fonts/ui.m3font"; // 构建时由 UI 字符串烘焙的字形子集
+        inline constexpr auto TEXTURE_ATLAS_PATH = "resources/textures/atlas.json"; // 构建时打包的纹理图集（可选）
+
         // 游戏板设置
         inline constexpr int BOARD_ROWS = 8;
         inline constexpr int BOARD_COLS = 8;
@@ -0,0 +1,97 @@
+#include "DebugOverlay.hpp"
+#include "RenderStats.hpp"
+#include "Render/Renderer.hpp"
+#include <algorithm>
+#include <format>
+
+namespace Match3
+{
+    DebugOverlay::DebugOverlay(FontRenderer* fontRenderer)
+        : m_fontRenderer(fontRenderer)
+        , m_elapsed(0.0f)
+        , m_visible(false)
+    {
+    }
+
+    void DebugOverlay::SetVisible(const bool visible)
+    {
+        m_visible = visible;
+        // 打开时立即用下一帧的统计刷新
+        m_elapsed = REFRESH_INTERVAL;
+    }
+
+    bool DebugOverlay::Update(const RenderStats& stats, const float fps, const float deltaTime)
+    {
+        if (!m_visible)
+        {
+            return false;
+        }
+
+        m_elapsed += deltaTime;
+        if (m_elapsed < REFRESH_INTERVAL)
+        {
+            return false;
+        }
+        m_elapsed = 0.0f;
+
+        const auto& renderer = stats.renderer;
+        const auto& text = stats.text;
+        const auto& ui = stats.ui;
+        const auto& entities = stats.entities;
+
+        m_lines.clear();
+        m_lines.push_back(std::format("FPS {:.1f}  render {:.2f} ms  present {:.2f} ms",
+                                      fps, stats.renderMs, renderer.presentMs));
+        m_lines.push_back(std::format("draw calls {} (text {})  batches {}  state changes {}",
+                                      stats.GetDrawCalls(), text.drawCalls, renderer.batches,
+                                      renderer.stateChanges));
+        m_lines.push_back(std::format("vertices {}  quads {}  rects {}  lines {}  points {}",
+                                      renderer.vertices + text.vertices, renderer.textureDraws,
+                                      renderer.rects, renderer.lines, renderer.points));
+        m_lines.push_back(std::format("textures +{} -{}  text rasterised {}  runs laid out {}  glyphs {}",
+                                      renderer.texturesCreated, renderer.texturesDestroyed,
+                                      text.textRasterisations, text.runLayouts, text.glyphsRasterised));
+        m_lines.push_back(std::format("ui {} drawn  {} hidden  {} static",
+                                      ui.rendered, ui.hidden, ui.staticRendered));
+        m_lines.push_back(std::format("gems {} (culled {})  particles {} (culled {})  fallback {}",
+                                      entities.gemsDrawn, entities.gemsCulled, entities.particlesDrawn,
+                                      entities.particlesCulled, entities.fallbackDraws));
+        return true;
+    }
+
+    void DebugOverlay::Render(Renderer& renderer)
+    {
+        if (!m_visible || m_lines.empty() || !m_fontRenderer)
+        {
+            return;
+        }
+
+        if (!m_font.IsValid())
+        {
+            m_font = m_fontRenderer->FindFont(FONT_ID);
+            if (!m_font.IsValid())
+            {
+                return;
+            }
+        }
+
+        const int lineHeight = m_fontRenderer->GetTextHeight(m_font);
+        int width = 0;
+        for (const auto& line : m_lines)
+        {
+            width = std::max(width, m_fontRenderer->MeasureText(line, m_font));
+        }
+
+        // 半透明底板保证在任何场景上都可读
+        renderer.SetDrawColor(0, 0, 0, 180);
+        renderer.FillRect(MARGIN, MARGIN, width + PADDING * 2,
+                          lineHeight * static_cast<int>(m_lines.size()) + PADDING * 2);
+
+        int y = MARGIN + PADDING;
+        for (const auto& line : m_lines)
+        {
+            m_fontRenderer->RenderText(line, MARGIN + PADDING, y, m_font, 255, 255, 160, 255);
+            y += lineHeight;
+        }
+    }
+} // namespace Match3
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Render/FontRenderer.hpp"
+#include <string>
+#include <vector>
+
+namespace Match3
+{
+    class Renderer;
+    struct RenderStats;
+
+    /**
+     * @brief 渲染统计叠加层（F3 切换）
+     *
+     * 在画面左上角显示帧率、渲染耗时和 RenderStats 的各项计数。
+     * 文字按 REFRESH_INTERVAL 重建，不会每帧产生新的文字排版；
+     * 叠加层自身的绘制计入统计（几次矩形和文字绘制）。
+     */
+    class DebugOverlay
+    {
+    public:
+        static constexpr float REFRESH_INTERVAL = 0.25f; // 文字刷新间隔（秒）
+        static constexpr auto FONT_ID = "small";
+        static constexpr int MARGIN = 8;
+        static constexpr int PADDING = 6;
+
+        explicit DebugOverlay(FontRenderer* fontRenderer);
+
+        void Toggle() { SetVisible(!m_visible); }
+        void SetVisible(bool visible);
+        [[nodiscard]] bool IsVisible() const { return m_visible; }
+
+        /**
+         * @brief 记录一帧的统计，到刷新间隔时重建显示文字
+         * @param stats 刚结束的一帧的统计
+         * @param fps 当前帧率
+         * @param deltaTime 距上次调用的时间（秒）
+         * @return 文字已更新（需要重绘才能显示）返回 true
+         */
+        bool Update(const RenderStats& stats, float fps, float deltaTime);
+
+        /**
+         * @brief 绘制叠加层（由 Renderer 的叠加层回调在 Present 时调用）
+         */
+        void Render(Renderer& renderer);
+
+    private:
+        FontRenderer* m_fontRenderer; // 不拥有所有权
+        FontHandle m_font;            // 首次绘制时解析
+        std::vector<std::string> m_lines;
+        float m_elapsed;
+        bool m_visible;
+    };
+} // namespace Match3
@@ -0,0 +1,200 @@
+#include "FramePacer.hpp"
+#include "Logger.hpp"
+#include <cmath>
+#include <numeric>
+
+namespace Match3
+{
+    FramePacer::FramePacer(SDL_Renderer* renderer, const Mode mode)
+        : m_renderer(renderer)
+          , m_mode(mode)
+    {
+        OnDisplayChanged();
+    }
+
+    void FramePacer::SetMode(const Mode mode)
+    {
+        if (mode == m_mode)
+        {
+            return;
+        }
+        m_mode = mode;
+        Configure();
+    }
+
+    void FramePacer::OnDisplayChanged()
+    {
+        m_refreshRate = 0.0f;
+        SDL_Window* window = m_renderer ? SDL_GetRenderWindow(m_renderer) : nullptr;
+        if (window)
+        {
+            if (const SDL_DisplayMode* mode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(window)))
+            {
+                m_refreshRate = mode->refresh_rate;
+            }
+        }
+
+        // 换了显示器，重新给垂直同步一次机会
+        m_vsyncRejected = false;
+        Configure();
+    }
+
+    void FramePacer::Configure()
+    {
+        const int targetFps = static_cast<int>(m_mode);
+        m_frameNs = targetFps > 0 ? 1'000'000'000ull / static_cast<uint64_t>(targetFps) : 0;
+
+        // 刷新率是目标帧率的整数倍时（如 60Hz 跑 30/60）交给垂直同步
+        int interval = 0;
+        if (targetFps > 0 && m_refreshRate > 0.0f && !m_vsyncRejected)
+        {
+            const float ratio = m_refreshRate / static_cast<float>(targetFps);
+            const float rounded = std::round(ratio);
+            if (rounded >= 1.0f && std::fabs(ratio - rounded) < 0.02f)
+            {
+                interval = static_cast<int>(rounded);
+            }
+        }
+
+        if (interval > 0 && !SDL_SetRenderVSync(m_renderer, interval))
+        {
+            LOG_WARN("FramePacer: VSync interval {} unsupported: {}", interval, SDL_GetError());
+            interval = 0;
+        }
+        if (interval == 0)
+        {
+            SDL_SetRenderVSync(m_renderer, 0);
+        }
+        m_vsyncInterval = interval;
+
+        Reset();
+        m_intervalCount = 0;
+        m_intervalIndex = 0;
+
+        if (targetFps == 0)
+        {
+            LOG_INFO("FramePacer: Uncapped");
+        }
+        else
+        {
+            LOG_INFO("FramePacer: Target {} FPS on {:.1f}Hz display, {}", targetFps, m_refreshRate,
+                     m_vsyncInterval > 0 ? "vsync" : "timed wait");
+        }
+    }
+
+    void FramePacer::EndFrame()
+    {
+        RecordInterval(SDL_GetTicksNS());
+        CheckVSyncHonored();
+
+        // 垂直同步由 Present 阻塞；不限帧率时直接继续
+        if (m_vsyncInterval > 0 || m_frameNs == 0)
+        {
+            return;
+        }
+
+        const uint64_t now = SDL_GetTicksNS();
+        if (m_deadline == 0)
+        {
+            m_deadline = now;
+        }
+        m_deadline += m_frameNs;
+
+        // 落后超过一帧时放弃追赶，从当前时间重新对齐
+        if (m_deadline < now)
+        {
+            m_deadline = now;
+            return;
+        }
+
+        WaitUntil(m_deadline);
+    }
+
+    void FramePacer::Reset()
+    {
+        m_deadline = 0;
+        m_lastPresent = 0;
+    }
+
+    float FramePacer::GetAverageIntervalMs() const
+    {
+        if (m_intervalCount == 0)
+        {
+            return 0.0f;
+        }
+        const uint64_t total = std::accumulate(m_intervals.begin(), m_intervals.begin() + m_intervalCount,
+                                               uint64_t{0});
+        return static_cast<float>(total / m_intervalCount) / 1'000'000.0f;
+    }
+
+    bool FramePacer::ParseMode(const std::string_view text, Mode& out)
+    {
+        if (text == "uncapped" || text == "0")
+        {
+            out = Mode::Uncapped;
+        }
+        else if (text == "30")
+        {
+            out = Mode::Fps30;
+        }
+        else if (text == "60")
+        {
+            out = Mode::Fps60;
+        }
+        else if (text == "120")
+        {
+            out = Mode::Fps120;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    void FramePacer::RecordInterval(const uint64_t now)
+    {
+        if (m_lastPresent != 0)
+        {
+            m_intervals[m_intervalIndex] = now - m_lastPresent;
+            m_intervalIndex = (m_intervalIndex + 1) % INTERVAL_SAMPLES;
+            if (m_intervalCount < INTERVAL_SAMPLES)
+            {
+                ++m_intervalCount;
+            }
+        }
+        m_lastPresent = now;
+    }
+
+    void FramePacer::CheckVSyncHonored()
+    {
+        if (m_vsyncInterval == 0 || m_intervalCount < INTERVAL_SAMPLES)
+        {
+            return;
+        }
+
+        // 实测间隔不到目标的一半：驱动没有真正等待垂直同步
+        const float expectedMs = static_cast<float>(m_frameNs) / 1'000'000.0f;
+        if (GetAverageIntervalMs() < expectedMs * 0.5f)
+        {
+            LOG_WARN("FramePacer: VSync not honored ({:.2f}ms vs {:.2f}ms) - using timed wait",
+                     GetAverageIntervalMs(), expectedMs);
+            m_vsyncRejected = true;
+            Configure();
+        }
+    }
+
+    void FramePacer::WaitUntil(const uint64_t deadline) const
+    {
+        // 粗略休眠到截止时间前 SPIN_THRESHOLD_NS，再自旋补足
+        const uint64_t now = SDL_GetTicksNS();
+        if (deadline > now + SPIN_THRESHOLD_NS)
+        {
+            SDL_DelayNS(deadline - now - SPIN_THRESHOLD_NS);
+        }
+        while (SDL_GetTicksNS() < deadline)
+        {
+            SDL_CPUPauseInstruction();
+        }
+    }
+} // namespace Match3
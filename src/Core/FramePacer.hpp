@@ -0,0 +1,89 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace Match3
+{
+    /**
+     * @brief 帧节奏控制 - 替代固定的 SDL_Delay(1)
+     *
+     * 目标帧率与显示器刷新率成整数倍关系时使用垂直同步（间隔 N 帧），
+     * 否则按截止时间精确等待：先粗略休眠，剩余不足 SPIN_THRESHOLD_NS 时自旋。
+     * 同时记录最近的呈现间隔；若开启垂直同步后实测间隔明显短于刷新周期
+     * （驱动忽略了垂直同步），自动退回到截止时间等待。
+     */
+    class FramePacer
+    {
+    public:
+        /**
+         * @brief 目标帧率模式（枚举值即帧率，0 表示不限制）
+         */
+        enum class Mode : int
+        {
+            Uncapped = 0,
+            Fps30 = 30,
+            Fps60 = 60,
+            Fps120 = 120
+        };
+
+        explicit FramePacer(SDL_Renderer* renderer, Mode mode = Mode::Fps60);
+
+        /**
+         * @brief 切换目标帧率并重新选择垂直同步/等待策略
+         */
+        void SetMode(Mode mode);
+        [[nodiscard]] Mode GetMode() const { return m_mode; }
+
+        /**
+         * @brief 显示器变化后重新读取刷新率并重新选择策略
+         */
+        void OnDisplayChanged();
+
+        /**
+         * @brief Present 之后调用：记录呈现间隔，必要时等待到下一帧截止时间
+         */
+        void EndFrame();
+
+        /**
+         * @brief 丢弃截止时间（例如空闲阻塞等待之后），下一帧重新计时
+         */
+        void Reset();
+
+        [[nodiscard]] bool IsVSyncActive() const { return m_vsyncInterval > 0; }
+
+        /**
+         * @brief 最近若干帧的平均呈现间隔（毫秒）
+         */
+        [[nodiscard]] float GetAverageIntervalMs() const;
+
+        /**
+         * @brief 解析 "30"/"60"/"120"/"uncapped"（或 "0"），失败返回 false
+         */
+        static bool ParseMode(std::string_view text, Mode& out);
+
+    private:
+        void Configure();
+        void RecordInterval(uint64_t now);
+        void CheckVSyncHonored();
+        void WaitUntil(uint64_t deadline) const;
+
+        static constexpr size_t INTERVAL_SAMPLES = 120;
+        static constexpr uint64_t SPIN_THRESHOLD_NS = 2'000'000; // 最后 2ms 自旋，避开休眠精度
+
+        SDL_Renderer* m_renderer;
+        Mode m_mode;
+        float m_refreshRate = 0.0f;   // 当前显示器刷新率（未知为 0）
+        int m_vsyncInterval = 0;      // 0 表示未使用垂直同步
+        bool m_vsyncRejected = false; // 实测证明垂直同步无效
+        uint64_t m_frameNs = 0;       // 目标帧间隔，0 表示不限制
+        uint64_t m_deadline = 0;
+        uint64_t m_lastPresent = 0;
+
+        std::array<uint64_t, INTERVAL_SAMPLES> m_intervals{};
+        size_t m_intervalCount = 0;
+        size_t m_intervalIndex = 0;
+    };
+} // namespace Match3
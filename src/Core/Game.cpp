@@ -1,15 +1,22 @@
 #include "Game.hpp"
 #include "Config.hpp"
 #include "Logger.hpp"
+#include "LaunchOptions.hpp"
 #include "Render/Renderer.hpp"
 #include "Render/ResourceManager.hpp"
 #include "Render/FontRenderer.hpp"
 #include "Input/InputManager.hpp"
 #include "Scenes/SceneManager.hpp"
 #include "Scenes/MenuScene.hpp"
+#include "Scenes/GameScene.hpp"
+#include "HeadlessSession.hpp"
+#include "FramePacer.hpp"
+#include "DebugOverlay.hpp"
+#include "Managers/AssetLoader.hpp"
 #include "Display/DisplayManager.hpp"
 #include <SDL3/SDL_timer.h>
 
+#include <algorithm>
 #include <utility>
 
 namespace Match3
@@ -25,6 +32,7 @@ namespace Match3
           , m_fps(0.0f)
           , m_frameTimeAccumulator(0.0f)
           , m_frameCount(0)
+          , m_overBudgetFrames(0)
     {
     }
 
@@ -37,6 +45,13 @@ namespace Match3
     {
         LOG_INFO("Initializing Match-3 Game...");
 
+        const bool headless = LaunchOptions::Get().headless;
+        if (headless)
+        {
+            // 离屏视频驱动：不需要显示器和 GPU
+            SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+        }
+
         // 初始化 SDL (音频是可选的)
         if (!SDL_Init(SDL_INIT_VIDEO))
         {
@@ -44,8 +59,12 @@ namespace Match3
             return false;
         }
 
-        // 尝试初始化音频（不强制要求）
-        if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0)
+        // 尝试初始化音频（不强制要求，无头模式跳过）
+        if (headless)
+        {
+            LOG_INFO("Headless mode - skipping audio");
+        }
+        else if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0)
         {
             LOG_WARN("Audio initialization failed: {} - continuing without audio", SDL_GetError());
         }
@@ -55,7 +74,18 @@ namespace Match3
         }
 
         // 创建窗口
-        if (!SDL_CreateWindowAndRenderer(
+        if (headless)
+        {
+            // 软件渲染器：结果只取决于 CPU 代码，逐帧哈希可复现
+            m_window = SDL_CreateWindow(m_title.c_str(), m_windowWidth, m_windowHeight, SDL_WINDOW_HIDDEN);
+            m_sdlRenderer = m_window ? SDL_CreateRenderer(m_window, SDL_SOFTWARE_RENDERER) : nullptr;
+            if (!m_window || !m_sdlRenderer)
+            {
+                LOG_ERROR("Headless window/renderer creation failed: {}", SDL_GetError());
+                return false;
+            }
+        }
+        else if (!SDL_CreateWindowAndRenderer(
             m_title.c_str(),
             m_windowWidth,
             m_windowHeight,
@@ -77,7 +107,8 @@ namespace Match3
         // 创建输入管理器
         m_inputManager = std::make_unique<InputManager>();
 
-        m_resourceManager = std::make_unique<ResourceManager>(m_sdlRenderer);
+        m_resourceManager = std::make_unique<ResourceManager>(m_sdlRenderer, Config::TEXTURE_BUDGET_BYTES);
+        m_renderer->SetResourceManager(m_resourceManager.get());
 
         // 初始化显示管理器
         LOG_INFO("Initializing DisplayManager");
@@ -91,13 +122,22 @@ namespace Match3
         // 尝试加载显示设置
         m_displayManager->LoadDisplaySettings();
 
-        // 初始化渲染资源
-        if (!InitializeRenderResources())
+        // 可选：场景画到固定逻辑分辨率的离屏目标，呈现时按缩放策略一次缩放
+        if (LaunchOptions::Get().logicalResolution)
         {
-            LOG_ERROR("Failed to initialize render resources");
-            return false;
+            m_renderer->EnableLogicalTarget(Display::ViewportManager::GAME_WIDTH,
+                                            Display::ViewportManager::GAME_HEIGHT);
         }
 
+        // 帧节奏控制（无头模式不限帧率，由 RunHeadless 逐帧推进）
+        m_framePacer = std::make_unique<FramePacer>(
+            m_sdlRenderer, headless ? FramePacer::Mode::Uncapped
+                                    : static_cast<FramePacer::Mode>(LaunchOptions::Get().targetFps));
+
+        // 资源在工作线程上读取/光栅化，渲染线程按帧预算上传
+        m_assetLoader = std::make_unique<AssetLoader>();
+        InitializeRenderResources();
+
         // 创建游戏状态管理器
         LOG_INFO("Initializing SceneManager");
         m_sceneManager = std::make_unique<SceneManager>();
@@ -111,31 +151,46 @@ namespace Match3
             return false;
         }
 
-        // 加载字体
-        if (!m_fontRenderer->LoadFont("resources/fonts/ZCOOLKuaiLe-Regular.ttf", 24, "default"))
+        // 加载字体：菜单只依赖字体，字体就绪即可显示第一帧
+        LoadFonts();
+        if (!m_assetLoader->WaitForCritical())
         {
-            LOG_ERROR("Failed to load default font");
+            LOG_ERROR("Failed to load critical assets");
             return false;
         }
-        if (!m_fontRenderer->LoadFont("resources/fonts/ZCOOLKuaiLe-Regular.ttf", 32, "title"))
-        {
-            LOG_ERROR("Failed to load title font");
-            return false;
-        }
-        if (!m_fontRenderer->LoadFont("resources/fonts/ZCOOLKuaiLe-Regular.ttf", 18, "small"))
+
+        m_fontRenderer->LogMemoryStats();
+
+        // 渲染统计叠加层（F3 切换）；无头模式不显示，以免计时文字破坏像素哈希
+        m_debugOverlay = std::make_unique<DebugOverlay>(m_fontRenderer.get());
+        m_debugOverlay->SetVisible(LaunchOptions::Get().renderStats && !headless);
+        m_renderer->SetOverlay([this](Renderer& renderer) { m_debugOverlay->Render(renderer); });
+
+        // 无头模式需要确定的首帧：等待全部资源
+        if (headless && !m_assetLoader->WaitForAll())
         {
-            LOG_ERROR("Failed to load small font");
-            return false;
+            LOG_WARN("Some deferred assets failed to load");
         }
 
         // 创建 UI 管理器
         // (现在由场景管理)
 
-        // 创建主菜单场景
-        m_sceneManager->ChangeScene(
-            std::make_unique<MenuScene>(m_renderer.get(), m_fontRenderer.get(),
-                                        m_sceneManager.get(), m_displayManager.get(),
-                                        m_windowWidth, m_windowHeight));
+        // 创建主菜单场景（无头模式直接进入对局）
+        const auto [sceneWidth, sceneHeight] = GetSceneSize();
+        if (headless)
+        {
+            m_sceneManager->ChangeScene(
+                std::make_unique<GameScene>(m_renderer.get(), m_fontRenderer.get(),
+                                            m_sceneManager.get(), m_displayManager.get(),
+                                            sceneWidth, sceneHeight));
+        }
+        else
+        {
+            m_sceneManager->ChangeScene(
+                std::make_unique<MenuScene>(m_renderer.get(), m_fontRenderer.get(),
+                                            m_sceneManager.get(), m_displayManager.get(),
+                                            sceneWidth, sceneHeight));
+        }
 
         m_isRunning = true;
         LOG_INFO("Game initialized successfully!");
@@ -143,36 +198,88 @@ namespace Match3
         return true;
     }
 
-    bool Game::InitializeRenderResources()
+    void Game::InitializeRenderResources()
     {
         LOG_INFO("Initializing render resources...");
 
-        // 创建宝石纹理（使用配置中定义的颜色）
-        for (int i = 0; i < Config::GEM_TYPES; ++i)
+        // 构建时打包的图集（有美术资源时才存在）：宝石、粒子和 UI 皮肤共用页面纹理，
+        // 其中的 gem_<类型>/particle 精灵替换下面程序生成的精灵
+        if (SDL_GetPathInfo(Config::TEXTURE_ATLAS_PATH, nullptr))
         {
-            const auto& [r, g, b, a] = Config::GEM_COLORS[i];
-            const std::string textureName = "gem_" + std::to_string(i);
-
-            if (!m_resourceManager->CreateColorTexture(
-                textureName,
-                Config::GEM_SIZE, Config::GEM_SIZE,
-                r, g, b, a))
-            {
-                LOG_ERROR("Failed to create gem texture {}", i);
-                return false;
-            }
+            m_assetLoader->LoadFile(Config::TEXTURE_ATLAS_PATH, AssetLoader::Priority::Deferred,
+                                    [this](const AssetLoader::FileData& data)
+                                    {
+                                        return data && m_resourceManager->LoadAtlas(Config::TEXTURE_ATLAS_PATH, *data);
+                                    });
         }
 
-        LOG_INFO("Render resources initialized successfully");
-        return true;
+        // 预渲染宝石与粒子精灵（替代逐像素画圆）：工作线程光栅化，渲染线程上传
+        // 就绪之前 RenderSystem 使用逐像素画圆
+        using SurfacePtr = std::unique_ptr<SDL_Surface, decltype(&SDL_DestroySurface)>;
+        auto sheet = std::make_shared<SurfacePtr>(nullptr, &SDL_DestroySurface);
+        constexpr int spriteRadius = Config::GEM_SIZE / 2 - Config::GEM_MARGIN;
+        m_assetLoader->Submit("gem_sprites", AssetLoader::Priority::Deferred,
+                              [sheet]()
+                              {
+                                  sheet->reset(ResourceManager::RasterizeGemSprites(spriteRadius));
+                              },
+                              [this, sheet]()
+                              {
+                                  const bool uploaded = m_resourceManager->UploadGemSprites(sheet->get(), spriteRadius);
+                                  sheet->reset();
+                                  if (!uploaded)
+                                  {
+                                      LOG_WARN("Failed to create gem sprites - falling back to per-pixel circles");
+                                  }
+                                  return uploaded;
+                              });
+    }
+
+    void Game::LoadFonts()
+    {
+        struct FontSpec
+        {
+            const char* id;
+            int size;
+        };
+        static constexpr FontSpec fonts[] = {{"default", 24}, {"title", 32}, {"small", 18}};
+
+        // 优先加载构建时烘焙的字形子集：一次读取，无需解析 TTF；
+        // 完整字体只在动态文本用到子集外的字形时才读取
+        m_assetLoader->LoadFile(Config::UI_BAKED_FONT_PATH, AssetLoader::Priority::Critical,
+                                [this](const AssetLoader::FileData& data)
+                                {
+                                    if (!data || !m_fontRenderer->LoadBakedFonts(Config::UI_FONT_PATH, data))
+                                    {
+                                        LOG_WARN("Baked UI font unavailable, parsing {}", Config::UI_FONT_PATH);
+                                    }
+
+                                    // 烘焙文件缺少的字号回退到完整字体（同一文件只解析一次）
+                                    bool loaded = true;
+                                    for (const auto& [id, size] : fonts)
+                                    {
+                                        if (!m_fontRenderer->HasFont(id))
+                                        {
+                                            loaded = m_fontRenderer->LoadFont(Config::UI_FONT_PATH, size, id) && loaded;
+                                        }
+                                    }
+                                    return loaded;
+                                });
     }
 
     void Game::Run()
     {
+        if (LaunchOptions::Get().headless)
+        {
+            RunHeadless();
+            return;
+        }
+
         LOG_INFO("Starting game loop...");
 
         Uint64 lastTime = SDL_GetTicksNS();
         float accumulator = 0.0f;
+        const bool damageTracking = LaunchOptions::Get().damageTracking;
 
         while (m_isRunning)
         {
@@ -192,29 +299,73 @@ namespace Match3
             // 处理输入
             HandleEvents();
 
+            // 完成后台加载好的资源（限时，不拖慢帧率）
+            if (m_assetLoader->IsBusy() && m_assetLoader->Update(Config::ASSET_UPLOAD_BUDGET_NS) > 0)
+            {
+                m_sceneManager->MarkDirty();
+            }
+
             // 固定时间步长更新
-            while (accumulator >= FIXED_TIMESTEP)
+            while (accumulator >= Config::FIXED_TIMESTEP)
             {
                 if (!m_isPaused)
                 {
-                    Update(FIXED_TIMESTEP);
+                    Update(Config::FIXED_TIMESTEP);
                 }
-                accumulator -= FIXED_TIMESTEP;
+                accumulator -= Config::FIXED_TIMESTEP;
             }
 
-            // 渲染
-            Render();
+            // 渲染（损伤跟踪模式下画面无变化时跳过，阻塞等待输入）
+            if (!damageTracking || NeedsRedraw())
+            {
+                Render();
+                ClearRedrawFlags();
 
-            // 更新 FPS
-            UpdateFPS(deltaTime);
+                // 更新 FPS
+                UpdateFPS(deltaTime);
 
-            // 限制帧率（避免 CPU 占用过高）
-            SDL_Delay(1);
+                // 垂直同步或等待到下一帧截止时间
+                m_framePacer->EndFrame();
+            }
+            else
+            {
+                SDL_WaitEventTimeout(nullptr, Config::IDLE_WAIT_TIMEOUT_MS);
+                m_framePacer->Reset();
+            }
         }
 
         LOG_INFO("Game loop ended");
     }
 
+    void Game::RunHeadless()
+    {
+        const auto& options = LaunchOptions::Get();
+        LOG_INFO("Starting headless session ({} frames)...", options.headlessFrames);
+
+        HeadlessSession session(options.headlessFrames, options.reportPath);
+        m_renderer->SetPresentHook([&session](SDL_Renderer* renderer) { session.CaptureFrame(renderer); });
+
+        // 固定步长：每帧恰好一次逻辑更新，结果与墙钟时间无关
+        for (int frame = 0; frame < session.GetFrameCount() && m_isRunning; ++frame)
+        {
+            session.BeginFrame(frame);
+            HandleEvents();
+
+            const Uint64 updateStart = SDL_GetTicksNS();
+            Update(Config::FIXED_TIMESTEP);
+            const Uint64 renderStart = SDL_GetTicksNS();
+            Render();
+            const Uint64 renderEnd = SDL_GetTicksNS();
+            ClearRedrawFlags(); // 与 Run() 一致，后续帧走缓存路径
+
+            session.EndFrame(renderStart - updateStart, renderEnd - renderStart, m_renderStats);
+        }
+
+        m_renderer->SetPresentHook(nullptr);
+        session.Finish();
+        LOG_INFO("Headless session ended");
+    }
+
     void Game::Shutdown()
     {
         LOG_INFO("Shutting down game...");
@@ -225,10 +376,21 @@ namespace Match3
             m_displayManager->SaveDisplaySettings();
         }
 
+        m_assetLoader.reset(); // 先停止工作线程，未完成的任务引用下面的对象
+        m_framePacer.reset();
         m_sceneManager.reset();
+        if (m_renderer)
+        {
+            m_renderer->SetOverlay(nullptr);
+        }
+        m_debugOverlay.reset();
         m_fontRenderer.reset();
         m_displayManager.reset();
         m_inputManager.reset();
+        if (m_renderer)
+        {
+            m_renderer->SetResourceManager(nullptr);
+        }
         m_resourceManager.reset();
         m_renderer.reset();
 
@@ -283,7 +445,8 @@ namespace Match3
                 // 通知场景管理器窗口大小变化
                 if (m_sceneManager)
                 {
-                    m_sceneManager->NotifyWindowResize(m_windowWidth, m_windowHeight);
+                    const auto [sceneWidth, sceneHeight] = GetSceneSize();
+                    m_sceneManager->NotifyWindowResize(sceneWidth, sceneHeight);
                 }
                 break;
 
@@ -296,12 +459,70 @@ namespace Match3
                 {
                     m_displayManager->HandleDisplayChangeEvent(event.display);
                 }
+                if (m_framePacer)
+                {
+                    m_framePacer->OnDisplayChanged();
+                }
+                break;
+
+            case SDL_EVENT_WINDOW_DISPLAY_CHANGED:
+                // 窗口移到了刷新率可能不同的显示器
+                if (m_framePacer)
+                {
+                    m_framePacer->OnDisplayChanged();
+                }
+                break;
+
+            case SDL_EVENT_RENDER_DEVICE_RESET:
+                // 设备丢失：所有纹理内容失效，清空缓存，下次使用时重新加载
+                LOG_WARN("Render device reset - purging texture cache");
+                if (m_resourceManager)
+                {
+                    m_resourceManager->Purge(true);
+                }
+                [[fallthrough]];
+
+            case SDL_EVENT_RENDER_TARGETS_RESET:
+                // 渲染目标纹理内容丢失，让场景重建缓存图层
+                LOG_WARN("Render targets reset - rebuilding cached layers");
+                if (m_sceneManager)
+                {
+                    const auto [sceneWidth, sceneHeight] = GetSceneSize();
+                    m_sceneManager->NotifyWindowResize(sceneWidth, sceneHeight);
+                }
+                break;
+
+            case SDL_EVENT_LOW_MEMORY:
+                // 系统内存紧张（移动端）：释放本帧未用到的纹理
+                LOG_WARN("Low memory - purging unused textures");
+                if (m_resourceManager)
+                {
+                    m_resourceManager->Purge(false);
+                }
+                break;
+
+            case SDL_EVENT_WINDOW_EXPOSED:
+                // 窗口内容可能已失效，必须重绘
+                if (m_sceneManager)
+                {
+                    m_sceneManager->MarkDirty();
+                }
                 break;
 
             case SDL_EVENT_KEY_DOWN:
+                if (event.key.key == SDLK_F3 && !event.key.repeat && m_debugOverlay)
+                {
+                    m_debugOverlay->Toggle();
+                    if (m_sceneManager)
+                    {
+                        m_sceneManager->MarkDirty();
+                    }
+                    break;
+                }
                 if (m_sceneManager)
                 {
                     m_sceneManager->HandleKeyPress(event.key.key);
+                    m_sceneManager->MarkDirty();
                 }
                 break;
 
@@ -313,26 +534,28 @@ namespace Match3
                     // after resolution/scale changes. Forward raw window coordinates
                     // (event.motion.x/y) to the scene manager so UI and board hit
                     // tests use the same coordinate space as rendering/UI creation.
-                    m_sceneManager->HandleMouseMove(static_cast<int>(event.motion.x),
-                                                    static_cast<int>(event.motion.y));
+                    const auto [x, y] = ToSceneCoords(event.motion.x, event.motion.y);
+                    m_sceneManager->HandleMouseMove(x, y);
                 }
                 break;
 
             case SDL_EVENT_MOUSE_BUTTON_DOWN:
                 if (event.button.button == SDL_BUTTON_LEFT && m_sceneManager /* && m_displayManager */)
                 {
-                    // Forward raw window coordinates to scene manager
-                    m_sceneManager->HandleMouseDown(static_cast<int>(event.button.x),
-                                                    static_cast<int>(event.button.y));
+                    // Forward window coordinates (mapped only in logical-resolution mode)
+                    const auto [x, y] = ToSceneCoords(event.button.x, event.button.y);
+                    m_sceneManager->HandleMouseDown(x, y);
+                    m_sceneManager->MarkDirty();
                 }
                 break;
 
             case SDL_EVENT_MOUSE_BUTTON_UP:
                 if (event.button.button == SDL_BUTTON_LEFT && m_sceneManager /* && m_displayManager */)
                 {
-                    // Forward raw window coordinates to scene manager
-                    m_sceneManager->HandleMouseUp(static_cast<int>(event.button.x),
-                                                  static_cast<int>(event.button.y));
+                    // Forward window coordinates (mapped only in logical-resolution mode)
+                    const auto [x, y] = ToSceneCoords(event.button.x, event.button.y);
+                    m_sceneManager->HandleMouseUp(x, y);
+                    m_sceneManager->MarkDirty();
                 }
                 break;
 
@@ -364,13 +587,110 @@ namespace Match3
         }
     }
 
+    bool Game::NeedsRedraw() const
+    {
+        if (m_displayManager && m_displayManager->NeedsRedraw())
+        {
+            return true;
+        }
+        return m_sceneManager && m_sceneManager->NeedsRedraw();
+    }
+
+    void Game::ClearRedrawFlags()
+    {
+        if (m_displayManager)
+        {
+            m_displayManager->ClearRedrawFlag();
+        }
+        if (m_sceneManager)
+        {
+            m_sceneManager->ClearRedrawFlag();
+        }
+    }
+
     void Game::Render()
     {
+        const uint64_t renderStart = SDL_GetTicksNS();
+
+        // 推进纹理 LRU 时钟
+        if (m_resourceManager)
+        {
+            m_resourceManager->BeginFrame();
+        }
+
+        // 逻辑分辨率模式：呈现区域跟随窗口尺寸和缩放策略
+        if (m_renderer->HasLogicalTarget() && m_displayManager)
+        {
+            m_renderer->SetPresentRect(m_displayManager->GetViewportRect(),
+                                       m_displayManager->GetPresentScaleMode());
+        }
+
         // 场景会自己处理清屏和渲染
         if (m_sceneManager)
         {
             m_sceneManager->Render();
         }
+
+        CollectRenderStats(SDL_GetTicksNS() - renderStart);
+    }
+
+    void Game::CollectRenderStats(const uint64_t renderNs)
+    {
+        m_fontRenderer->EndFrame();
+
+        RenderStats stats;
+        stats.renderer = m_renderer->GetFrameStats();
+        stats.text = m_fontRenderer->GetFrameStats();
+        if (const Scene* scene = m_sceneManager ? m_sceneManager->GetCurrentScene() : nullptr)
+        {
+            scene->CollectRenderStats(stats);
+        }
+        // 呈现耗时包含垂直同步等待，单独统计
+        stats.renderMs = std::max(0.0f, static_cast<float>(renderNs) / 1'000'000.0f - stats.renderer.presentMs);
+
+        m_renderStats = stats;
+        CheckRenderBudget();
+    }
+
+    void Game::CheckRenderBudget()
+    {
+        const RenderStats& stats = m_renderStats;
+        auto over = [](const auto value, const auto budget) { return budget > 0 && value > budget; };
+
+        const int drawCalls = stats.GetDrawCalls();
+        if (!over(drawCalls, Config::RENDER_BUDGET_DRAW_CALLS) &&
+            !over(stats.text.textRasterisations, Config::RENDER_BUDGET_TEXT_RASTERISATIONS) &&
+            !over(stats.renderer.texturesCreated, Config::RENDER_BUDGET_TEXTURES_CREATED) &&
+            !over(stats.renderMs, Config::RENDER_BUDGET_MS))
+        {
+            return;
+        }
+
+        m_overBudgetFrames++;
+        m_budgetPeak.renderer.drawCalls = std::max(m_budgetPeak.renderer.drawCalls, drawCalls);
+        m_budgetPeak.text.textRasterisations = std::max(m_budgetPeak.text.textRasterisations,
+                                                        stats.text.textRasterisations);
+        m_budgetPeak.renderer.texturesCreated = std::max(m_budgetPeak.renderer.texturesCreated,
+                                                         stats.renderer.texturesCreated);
+        m_budgetPeak.renderMs = std::max(m_budgetPeak.renderMs, stats.renderMs);
+    }
+
+    std::pair<int, int> Game::GetSceneSize() const
+    {
+        if (m_renderer && m_renderer->HasLogicalTarget())
+        {
+            return {Display::ViewportManager::GAME_WIDTH, Display::ViewportManager::GAME_HEIGHT};
+        }
+        return {m_windowWidth, m_windowHeight};
+    }
+
+    std::pair<int, int> Game::ToSceneCoords(const float windowX, const float windowY) const
+    {
+        if (m_renderer && m_renderer->HasLogicalTarget() && m_displayManager)
+        {
+            return m_displayManager->WindowToGameCoords(static_cast<int>(windowX), static_cast<int>(windowY));
+        }
+        return {static_cast<int>(windowX), static_cast<int>(windowY)};
     }
 
     void Game::UpdateFPS(float deltaTime)
@@ -378,13 +698,33 @@ namespace Match3
         m_frameTimeAccumulator += deltaTime;
         m_frameCount++;
 
+        // 叠加层文字更新后需要再画一帧才能看到（损伤跟踪模式）
+        if (m_debugOverlay && m_debugOverlay->Update(m_renderStats, m_fps, deltaTime) && m_sceneManager)
+        {
+            m_sceneManager->MarkDirty();
+        }
+
         // 每秒更新一次 FPS
         if (m_frameTimeAccumulator >= 1.0f)
         {
             m_fps = m_frameCount / m_frameTimeAccumulator;
 
-            LOG_DEBUG("FPS: {:.1f} | Frame Time: {:.2f}ms",
-                      m_fps, (m_frameTimeAccumulator / m_frameCount) * 1000.0f);
+            LOG_DEBUG("FPS: {:.1f} | Frame Time: {:.2f}ms | Render: {:.2f}ms | Draw Calls: {}",
+                      m_fps, (m_frameTimeAccumulator / m_frameCount) * 1000.0f,
+                      m_renderStats.renderMs, m_renderStats.GetDrawCalls());
+
+            if (m_overBudgetFrames > 0)
+            {
+                LOG_WARN("Render budget exceeded in {}/{} frame(s): peak {} draw calls, {} text rasterisation(s), "
+                         "{} texture(s) created, {:.2f}ms (budget {} / {} / {} / {:.1f}ms)",
+                         m_overBudgetFrames, m_frameCount, m_budgetPeak.renderer.drawCalls,
+                         m_budgetPeak.text.textRasterisations, m_budgetPeak.renderer.texturesCreated,
+                         m_budgetPeak.renderMs, Config::RENDER_BUDGET_DRAW_CALLS,
+                         Config::RENDER_BUDGET_TEXT_RASTERISATIONS, Config::RENDER_BUDGET_TEXTURES_CREATED,
+                         Config::RENDER_BUDGET_MS);
+                m_overBudgetFrames = 0;
+                m_budgetPeak = {};
+            }
 
             m_frameTimeAccumulator = 0.0f;
             m_frameCount = 0;
@@ -1,8 +1,10 @@
 #pragma once
 
+#include "RenderStats.hpp"
 #include <SDL3/SDL.h>
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace Match3
 {
@@ -11,6 +13,9 @@ namespace Match3
     class InputManager;
     class FontRenderer;
     class SceneManager;
+    class FramePacer;
+    class AssetLoader;
+    class DebugOverlay;
 
     namespace Display
     {
@@ -51,7 +56,17 @@ namespace Match3
          */
         [[nodiscard]] bool IsRunning() const { return m_isRunning; }
 
+        /**
+         * @brief 最近一次渲染的帧统计（绘制调用、纹理、文字、UI、实体剔除）
+         */
+        [[nodiscard]] const RenderStats& GetRenderStats() const { return m_renderStats; }
+
     private:
+        /**
+         * @brief 无头模式主循环：固定步长、脚本输入、逐帧计时与像素哈希
+         */
+        void RunHeadless();
+
         /**
          * @brief 处理输入事件
          */
@@ -68,15 +83,51 @@ namespace Match3
          */
         void Render();
 
+        /**
+         * @brief 是否需要重绘（场景或显示设置有变化）
+         */
+        bool NeedsRedraw() const;
+
+        /**
+         * @brief 清除场景和显示管理器的重绘标记
+         */
+        void ClearRedrawFlags();
+
+        /**
+         * @brief 场景使用的坐标空间尺寸（逻辑分辨率模式下固定，否则为窗口尺寸）
+         */
+        [[nodiscard]] std::pair<int, int> GetSceneSize() const;
+
+        /**
+         * @brief 窗口坐标 → 场景坐标（逻辑分辨率模式下经视口逆变换）
+         */
+        [[nodiscard]] std::pair<int, int> ToSceneCoords(float windowX, float windowY) const;
+
         /**
          * @brief 计算 FPS
          */
         void UpdateFPS(float deltaTime);
 
         /**
-         * @brief 初始化渲染资源
+         * @brief 渲染结束后收集各子系统的帧统计并检查预算
+         * @param renderNs 本帧 Render() 的总耗时（纳秒）
+         */
+        void CollectRenderStats(uint64_t renderNs);
+
+        /**
+         * @brief 记录超出 Config::RENDER_BUDGET_* 的帧，由 UpdateFPS 每秒汇总告警
+         */
+        void CheckRenderBudget();
+
+        /**
+         * @brief 提交渲染资源的异步加载任务（首帧之后陆续就绪）
+         */
+        void InitializeRenderResources();
+
+        /**
+         * @brief 提交 UI 字体的异步加载任务（首个场景必需）
          */
-        bool InitializeRenderResources();
+        void LoadFonts();
 
     private:
         std::string m_title;
@@ -92,6 +143,9 @@ namespace Match3
         std::unique_ptr<FontRenderer> m_fontRenderer;
         std::unique_ptr<SceneManager> m_sceneManager;
         std::unique_ptr<Display::DisplayManager> m_displayManager;
+        std::unique_ptr<FramePacer> m_framePacer;
+        std::unique_ptr<AssetLoader> m_assetLoader;
+        std::unique_ptr<DebugOverlay> m_debugOverlay;
 
         bool m_isRunning;
         bool m_isPaused;
@@ -101,8 +155,9 @@ namespace Match3
         float m_frameTimeAccumulator;
         int m_frameCount;
 
-        // 固定时间步长（秒）
-        static constexpr float TARGET_FPS = 60.0f;
-        static constexpr float FIXED_TIMESTEP = 1.0f / TARGET_FPS;
+        // 渲染统计与预算告警
+        RenderStats m_renderStats;
+        RenderStats m_budgetPeak; // 本秒内超预算帧的各项最大值
+        int m_overBudgetFrames;
     };
 } // namespace Match3
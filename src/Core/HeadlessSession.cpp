@@ -0,0 +1,167 @@
+#include "HeadlessSession.hpp"
+#include "Config.hpp"
+#include "Logger.hpp"
+#include "RenderStats.hpp"
+#include "Input/MouseHandler.hpp"
+#include "Utils/Hash.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace Match3
+{
+    namespace
+    {
+        constexpr int WARMUP_FRAMES = 10;   // 等待开局动画
+        constexpr int MOVE_INTERVAL = 30;   // 每隔多少帧尝试一次交换
+        constexpr int SECOND_CLICK_DELAY = 5;
+
+        double ToMs(uint64_t ns)
+        {
+            return static_cast<double>(ns) / 1'000'000.0;
+        }
+
+        uint64_t Percentile(std::vector<uint64_t> values, double p)
+        {
+            if (values.empty()) return 0;
+            const auto index = static_cast<size_t>(p * static_cast<double>(values.size() - 1));
+            std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+            return values[index];
+        }
+    } // namespace
+
+    HeadlessSession::HeadlessSession(int frameCount, std::string reportPath)
+        : m_frameCount(std::max(frameCount, 1))
+        , m_reportPath(std::move(reportPath))
+    {
+        m_records.reserve(static_cast<size_t>(m_frameCount));
+    }
+
+    void HeadlessSession::BeginFrame(const int frame)
+    {
+        if (frame < WARMUP_FRAMES)
+        {
+            return;
+        }
+
+        // 脚本：每个周期选一个格子，随后点击其右侧或下方的邻居
+        const int phase = (frame - WARMUP_FRAMES) % MOVE_INTERVAL;
+        if (phase == 0)
+        {
+            m_scriptState = m_scriptState * 1664525u + 1013904223u;
+            m_row = static_cast<int>((m_scriptState >> 8) % (Config::BOARD_ROWS - 1));
+            m_col = static_cast<int>((m_scriptState >> 16) % (Config::BOARD_COLS - 1));
+            PushClick(m_row, m_col);
+        }
+        else if (phase == SECOND_CLICK_DELAY)
+        {
+            const bool horizontal = (m_scriptState >> 24) & 1u;
+            PushClick(horizontal ? m_row : m_row + 1, horizontal ? m_col + 1 : m_col);
+        }
+    }
+
+    void HeadlessSession::PushClick(const int row, const int col)
+    {
+        const auto [x, y] = MouseHandler::BoardToScreen(row, col);
+
+        SDL_Event event{};
+        event.type = SDL_EVENT_MOUSE_BUTTON_DOWN;
+        event.button.button = SDL_BUTTON_LEFT;
+        event.button.down = true;
+        event.button.x = static_cast<float>(x);
+        event.button.y = static_cast<float>(y);
+        SDL_PushEvent(&event);
+
+        event.type = SDL_EVENT_MOUSE_BUTTON_UP;
+        event.button.down = false;
+        SDL_PushEvent(&event);
+    }
+
+    void HeadlessSession::CaptureFrame(SDL_Renderer* renderer)
+    {
+        SDL_Surface* surface = SDL_RenderReadPixels(renderer, nullptr);
+        if (!surface)
+        {
+            LOG_ERROR("HeadlessSession: Failed to read pixels: {}", SDL_GetError());
+            return;
+        }
+
+        // 逐行哈希，忽略行尾填充
+        const auto* pixels = static_cast<const uint8_t*>(surface->pixels);
+        const size_t rowBytes = static_cast<size_t>(surface->w) * SDL_BYTESPERPIXEL(surface->format);
+        uint64_t hash = Hash::FNV_OFFSET_BASIS;
+        for (int y = 0; y < surface->h; ++y)
+        {
+            hash = Hash::Fnv1a64(pixels + static_cast<size_t>(y) * surface->pitch, rowBytes, hash);
+        }
+        SDL_DestroySurface(surface);
+
+        m_pendingHash = hash;
+        m_hasPendingHash = true;
+    }
+
+    void HeadlessSession::EndFrame(const uint64_t updateNs, const uint64_t renderNs, const RenderStats& stats)
+    {
+        m_records.push_back({
+            updateNs, renderNs, m_hasPendingHash ? m_pendingHash : 0,
+            stats.GetDrawCalls(), stats.renderer.batches, stats.renderer.vertices + stats.text.vertices,
+            stats.renderer.texturesCreated, stats.text.textRasterisations
+        });
+        m_hasPendingHash = false;
+    }
+
+    bool HeadlessSession::Finish() const
+    {
+        std::vector<uint64_t> updates;
+        std::vector<uint64_t> renders;
+        updates.reserve(m_records.size());
+        renders.reserve(m_records.size());
+
+        // 整个会话的哈希（按帧哈希串联）
+        uint64_t sessionHash = Hash::FNV_OFFSET_BASIS;
+        int peakDrawCalls = 0;
+        int64_t totalDrawCalls = 0;
+        for (const auto& record : m_records)
+        {
+            updates.push_back(record.updateNs);
+            renders.push_back(record.renderNs);
+            sessionHash = Hash::Fnv1a64(&record.hash, sizeof(record.hash), sessionHash);
+            peakDrawCalls = std::max(peakDrawCalls, record.drawCalls);
+            totalDrawCalls += record.drawCalls;
+        }
+
+        LOG_INFO("Headless: {} frames, session hash {:016x}", m_records.size(), sessionHash);
+        LOG_INFO("Headless: update p50 {:.3f}ms p95 {:.3f}ms max {:.3f}ms",
+                 ToMs(Percentile(updates, 0.5)), ToMs(Percentile(updates, 0.95)), ToMs(Percentile(updates, 1.0)));
+        LOG_INFO("Headless: render p50 {:.3f}ms p95 {:.3f}ms max {:.3f}ms",
+                 ToMs(Percentile(renders, 0.5)), ToMs(Percentile(renders, 0.95)), ToMs(Percentile(renders, 1.0)));
+        if (!m_records.empty())
+        {
+            LOG_INFO("Headless: draw calls avg {:.1f} max {}",
+                     static_cast<double>(totalDrawCalls) / static_cast<double>(m_records.size()), peakDrawCalls);
+        }
+
+        std::ofstream file(m_reportPath);
+        if (!file)
+        {
+            LOG_ERROR("Headless: Failed to open report file '{}'", m_reportPath);
+            return false;
+        }
+
+        // 新列追加在 hash 之后，按列号读取旧报告的脚本不受影响
+        file << "frame,update_ms,render_ms,hash,draw_calls,batches,vertices,textures_created,text_rasterisations\n";
+        char line[160];
+        for (size_t i = 0; i < m_records.size(); ++i)
+        {
+            const auto& record = m_records[i];
+            std::snprintf(line, sizeof(line), "%zu,%.4f,%.4f,%016llx,%d,%d,%d,%d,%d\n", i,
+                          ToMs(record.updateNs), ToMs(record.renderNs),
+                          static_cast<unsigned long long>(record.hash), record.drawCalls, record.batches,
+                          record.vertices, record.texturesCreated, record.textRasterisations);
+            file << line;
+        }
+
+        LOG_INFO("Headless: Report written to '{}'", m_reportPath);
+        return true;
+    }
+} // namespace Match3
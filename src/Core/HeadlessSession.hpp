@@ -0,0 +1,75 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Match3
+{
+    struct RenderStats;
+
+    /**
+     * @brief 无头会话 - 脚本化输入、逐帧耗时与像素哈希
+     *
+     * 由 Game::RunHeadless() 驱动：每帧开始前注入脚本输入（鼠标点击棋盘），
+     * Present 之前读回像素计算 FNV-1a 哈希，帧结束时记录更新/渲染耗时。
+     * 结束后输出 CSV 报告（frame,update_ms,render_ms,hash 以及每帧绘制调用等渲染统计）和汇总日志，
+     * 用于在无 GPU、无显示器的 CI 上发现性能回退和渲染结果变化。
+     */
+    class HeadlessSession
+    {
+    public:
+        HeadlessSession(int frameCount, std::string reportPath);
+
+        /**
+         * @brief 帧开始：按脚本推送输入事件
+         */
+        void BeginFrame(int frame);
+
+        /**
+         * @brief 读回当前渲染目标并计算像素哈希（在 Present 之前调用）
+         */
+        void CaptureFrame(SDL_Renderer* renderer);
+
+        /**
+         * @brief 帧结束：记录耗时和渲染统计
+         */
+        void EndFrame(uint64_t updateNs, uint64_t renderNs, const RenderStats& stats);
+
+        /**
+         * @brief 写出报告并打印汇总
+         * @return 报告写入成功返回 true
+         */
+        bool Finish() const;
+
+        [[nodiscard]] int GetFrameCount() const { return m_frameCount; }
+
+    private:
+        struct FrameRecord
+        {
+            uint64_t updateNs = 0;
+            uint64_t renderNs = 0;
+            uint64_t hash = 0;
+            int drawCalls = 0;
+            int batches = 0;
+            int vertices = 0;
+            int texturesCreated = 0;
+            int textRasterisations = 0;
+        };
+
+        /**
+         * @brief 推送一次棋盘格子点击（按下 + 释放）
+         */
+        static void PushClick(int row, int col);
+
+        int m_frameCount;
+        std::string m_reportPath;
+        std::vector<FrameRecord> m_records;
+        uint64_t m_pendingHash = 0;
+        bool m_hasPendingHash = false;
+        uint32_t m_scriptState = 1; // 脚本自己的 LCG，不消耗游戏随机数
+        int m_row = 0;              // 当前周期选中的格子
+        int m_col = 0;
+    };
+} // namespace Match3
@@ -0,0 +1,132 @@
+#include "LaunchOptions.hpp"
+#include "Logger.hpp"
+#include "FramePacer.hpp"
+#include <charconv>
+#include <string_view>
+
+namespace Match3
+{
+    namespace
+    {
+        LaunchOptions s_options;
+
+        /**
+         * @brief 取出 --name=value 中的 value
+         */
+        std::string_view ValueOf(std::string_view arg)
+        {
+            return arg.substr(arg.find('=') + 1);
+        }
+
+        /**
+         * @brief 解析整数参数值，失败时保留原值并记录警告
+         */
+        template <typename T>
+        bool ParseNumber(std::string_view arg, T& out)
+        {
+            const std::string_view value = ValueOf(arg);
+            T parsed{};
+            const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+            if (ec != std::errc{} || ptr != value.data() + value.size())
+            {
+                LOG_WARN("LaunchOptions: Invalid value in '{}'", arg);
+                return false;
+            }
+
+            out = parsed;
+            return true;
+        }
+    }
+
+    void LaunchOptions::Parse(int argc, char* argv[])
+    {
+        s_options = LaunchOptions{};
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+
+            if (arg == "--threaded-sim")
+            {
+                s_options.threadedSimulation = true;
+            }
+            else if (arg == "--damage-tracking")
+            {
+                s_options.damageTracking = true;
+            }
+            else if (arg == "--logical-resolution")
+            {
+                s_options.logicalResolution = true;
+            }
+            else if (arg == "--render-stats")
+            {
+                s_options.renderStats = true;
+            }
+            else if (arg == "--debug-keys")
+            {
+                s_options.debugKeys = true;
+            }
+            else if (arg == "--headless")
+            {
+                s_options.headless = true;
+            }
+            else if (arg.starts_with("--frames="))
+            {
+                ParseNumber(arg, s_options.headlessFrames);
+            }
+            else if (arg.starts_with("--seed="))
+            {
+                s_options.hasSeed = ParseNumber(arg, s_options.seed) || s_options.hasSeed;
+            }
+            else if (arg.starts_with("--report="))
+            {
+                s_options.reportPath = std::string(ValueOf(arg));
+            }
+            else if (arg.starts_with("--fps="))
+            {
+                FramePacer::Mode mode{};
+                if (FramePacer::ParseMode(ValueOf(arg), mode))
+                {
+                    s_options.targetFps = static_cast<int>(mode);
+                }
+                else
+                {
+                    LOG_WARN("LaunchOptions: Invalid value in '{}' (expected 30, 60, 120 or uncapped)", arg);
+                }
+            }
+            else
+            {
+                LOG_WARN("LaunchOptions: Ignoring unknown argument '{}'", arg);
+            }
+        }
+
+        // 无头模式需要可复现：固定种子、单线程逻辑
+        if (s_options.headless)
+        {
+            if (!s_options.hasSeed)
+            {
+                s_options.hasSeed = true;
+                s_options.seed = 12345;
+            }
+            if (s_options.threadedSimulation)
+            {
+                LOG_WARN("LaunchOptions: --threaded-sim is not deterministic, disabled in headless mode");
+                s_options.threadedSimulation = false;
+            }
+        }
+
+        LOG_INFO("LaunchOptions: threaded simulation {}, damage tracking {}",
+                 s_options.threadedSimulation ? "on" : "off",
+                 s_options.damageTracking ? "on" : "off");
+        if (s_options.headless)
+        {
+            LOG_INFO("LaunchOptions: headless, {} frames, seed {}, report '{}'",
+                     s_options.headlessFrames, s_options.seed, s_options.reportPath);
+        }
+    }
+
+    const LaunchOptions& LaunchOptions::Get()
+    {
+        return s_options;
+    }
+} // namespace Match3
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace Match3
+{
+    /**
+     * @brief 启动参数 - 由 main() 解析命令行后全局只读访问
+     *
+     * 支持的参数：
+     * - --threaded-sim     在独立线程上运行棋盘逻辑，渲染线程插值显示
+     * - --damage-tracking  画面无变化时跳过渲染并阻塞等待事件
+     * - --headless         离屏软件渲染，运行脚本化对局并输出逐帧耗时与像素哈希
+     * - --frames=N         无头模式运行的帧数
+     * - --seed=N           固定随机种子（无头模式默认固定）
+     * - --report=PATH      无头模式报告（CSV）输出路径
+     * - --fps=30|60|120|uncapped  目标帧率（默认 60）
+     * - --logical-resolution  场景按固定逻辑分辨率渲染到离屏目标，呈现时一次缩放到窗口
+     * - --render-stats     启动时打开渲染统计叠加层（之后可用 F3 切换）
+     * - --debug-keys       启用调试按键：F5 保存检查点，F9 载入检查点
+     */
+    struct LaunchOptions
+    {
+        bool threadedSimulation = false;
+        bool damageTracking = false;
+        bool headless = false;
+        int headlessFrames = 600;
+        bool hasSeed = false;
+        uint32_t seed = 0;
+        std::string reportPath = "headless_report.csv";
+        int targetFps = 60; // 0 表示不限制，取值见 FramePacer::Mode
+        bool logicalResolution = false;
+        bool renderStats = false;
+        bool debugKeys = false;
+
+        /**
+         * @brief 解析命令行参数（未知参数会被忽略并记录警告）
+         */
+        static void Parse(int argc, char* argv[]);
+
+        /**
+         * @brief 获取当前启动参数
+         */
+        static const LaunchOptions& Get();
+    };
+} // namespace Match3
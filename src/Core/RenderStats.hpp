@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Render/Renderer.hpp"
+#include "Render/FontRenderer.hpp"
+#include "UI/UIManager.hpp"
+#include "Systems/RenderSystem.hpp"
+
+namespace Match3
+{
+    /**
+     * @brief 一帧的渲染统计汇总
+     *
+     * 由 Game 在每帧渲染后从各子系统收集（Game::GetRenderStats()），
+     * 供调试叠加层、无头报告和预算告警使用。各子系统的统计都是上一帧的完整值。
+     */
+    struct RenderStats
+    {
+        Renderer::FrameStats renderer;
+        FontRenderer::FrameStats text;
+        UIManager::FrameStats ui;                   // 当前场景
+        Systems::RenderSystem::FrameStats entities; // 只有游戏场景有
+        float renderMs = 0.0f;                      // Game::Render() 的 CPU 耗时（含呈现）
+
+        /**
+         * @brief 发给 SDL 的绘制调用总数（渲染器 + 文字）
+         */
+        [[nodiscard]] int GetDrawCalls() const { return renderer.drawCalls + text.drawCalls; }
+    };
+} // namespace Match3
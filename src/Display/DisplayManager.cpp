@@ -226,6 +226,11 @@ namespace Match3::Display
         return m_viewportManager->GetLetterboxRects();
     }
 
+    SDL_ScaleMode DisplayManager::GetPresentScaleMode() const
+    {
+        return m_viewportManager->GetPresentScaleMode();
+    }
+
     bool DisplayManager::ApplyDisplayMode(DisplayMode mode)
     {
         switch (mode)
@@ -147,6 +147,12 @@ namespace Match3::Display
          */
         std::vector<SDL_FRect> GetLetterboxRects() const;
 
+        /**
+         * @brief 获取逻辑画面缩放过滤方式
+         * @return SDL 缩放模式
+         */
+        [[nodiscard]] SDL_ScaleMode GetPresentScaleMode() const;
+
     private:
         SDL_Window* m_window;
         SDL_Renderer* m_renderer;
@@ -135,6 +135,11 @@ namespace Match3::Display
         };
     }
 
+    SDL_ScaleMode ViewportManager::GetPresentScaleMode() const
+    {
+        return m_strategy == ScalingStrategy::INTEGER_SCALE ? SDL_SCALEMODE_NEAREST : SDL_SCALEMODE_LINEAR;
+    }
+
     void ViewportManager::SetScalingStrategy(ScalingStrategy strategy)
     {
         m_strategy = strategy;
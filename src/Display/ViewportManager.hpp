@@ -90,6 +90,16 @@ namespace Match3::Display
          */
         [[nodiscard]] ScalingStrategy GetScalingStrategy() const { return m_strategy; }
 
+        /**
+         * @brief 逻辑画面缩放到视口时使用的过滤方式（整数倍缩放用最近邻，其余线性）
+         * @return SDL 缩放模式
+         */
+        [[nodiscard]] SDL_ScaleMode GetPresentScaleMode() const;
+
+        // 游戏逻辑分辨率（固定）
+        static constexpr int GAME_WIDTH = 800;
+        static constexpr int GAME_HEIGHT = 600;
+
     private:
         /**
          * @brief 内部视口结构
@@ -106,10 +116,6 @@ namespace Match3::Display
 
         Viewport m_viewport;
         ScalingStrategy m_strategy;
-        
-        // 游戏逻辑分辨率（固定）
-        static constexpr int GAME_WIDTH = 800;
-        static constexpr int GAME_HEIGHT = 600;
 
         /**
          * @brief 根据缩放策略计算视口
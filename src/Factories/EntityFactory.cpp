@@ -1,6 +1,7 @@
 #include "EntityFactory.hpp"
 #include "Core/Config.hpp"
 #include "Core/Logger.hpp"
+#include "Utils/Random.hpp"
 #include <random>
 #include <cmath>
 
@@ -57,8 +58,7 @@ void EntityFactory::CreateExplosion(float x, float y,
                                      int particleCount,
                                      float spreadSpeed)
 {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    auto& gen = Random::Engine();
     std::uniform_real_distribution<float> angleDist(0.0f, 2.0f * 3.14159f);
     std::uniform_real_distribution<float> speedDist(spreadSpeed * 0.5f, spreadSpeed * 1.5f);
     std::uniform_real_distribution<float> sizeDist(3.0f, 8.0f);
@@ -83,8 +83,7 @@ std::vector<entt::entity> EntityFactory::CreateBoard(int rows, int cols, int gem
     std::vector<entt::entity> entities;
     entities.reserve(rows * cols);
     
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    auto& gen = Random::Engine();
     std::uniform_int_distribution<int> typeDist(0, gemTypes - 1);
     
     for (int row = 0; row < rows; ++row) {
@@ -0,0 +1,239 @@
+#include "AssetLoader.hpp"
+#include "Core/Logger.hpp"
+#include <SDL3/SDL.h>
+#include <algorithm>
+
+namespace Match3
+{
+    namespace
+    {
+        constexpr int MAX_WORKERS = 4;
+    }
+
+    AssetLoader::AssetLoader(int workerCount)
+    {
+        if (workerCount <= 0)
+        {
+            // 留一个核心给渲染线程
+            workerCount = std::clamp(SDL_GetNumLogicalCPUCores() - 1, 1, MAX_WORKERS);
+        }
+
+        m_workers.reserve(static_cast<size_t>(workerCount));
+        for (int i = 0; i < workerCount; ++i)
+        {
+            m_workers.emplace_back(&AssetLoader::WorkerLoop, this);
+        }
+        LOG_INFO("AssetLoader: Started {} worker thread(s)", workerCount);
+    }
+
+    AssetLoader::~AssetLoader()
+    {
+        {
+            std::lock_guard lock(m_pendingMutex);
+            m_stopping = true;
+        }
+        m_pendingCondition.notify_all();
+
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+
+        if (m_outstanding > 0)
+        {
+            LOG_WARN("AssetLoader: Discarded {} unfinished task(s)", m_outstanding);
+        }
+    }
+
+    void AssetLoader::Submit(std::string name, const Priority priority, WorkFn work, FinalizeFn finalize)
+    {
+        ++m_outstanding;
+        if (priority == Priority::Critical)
+        {
+            ++m_outstandingCritical;
+        }
+
+        Task task{std::move(name), priority, std::move(work), std::move(finalize)};
+
+        // 没有工作线程步骤时直接进入就绪队列
+        if (!task.work)
+        {
+            PushReady(std::move(task));
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_pendingMutex);
+            auto& queue = priority == Priority::Critical ? m_pendingCritical : m_pendingDeferred;
+            queue.push_back(std::move(task));
+        }
+        m_pendingCondition.notify_one();
+    }
+
+    void AssetLoader::LoadFile(const std::string& path, const Priority priority, FileCallback onLoaded)
+    {
+        // 同一优先级的重复请求合并；优先级不同则单独读取，保证 Critical 计数准确
+        std::string key = path;
+        key += priority == Priority::Critical ? "#critical" : "#deferred";
+
+        if (const auto it = m_fileRequests.find(key); it != m_fileRequests.end())
+        {
+            it->second->callbacks.push_back(std::move(onLoaded));
+            return;
+        }
+
+        auto request = std::make_shared<FileRequest>();
+        request->callbacks.push_back(std::move(onLoaded));
+        m_fileRequests.emplace(key, request);
+
+        Submit(path, priority,
+               [request, path]()
+               {
+                   size_t size = 0;
+                   void* raw = SDL_LoadFile(path.c_str(), &size);
+                   if (!raw)
+                   {
+                       return;
+                   }
+                   const auto* bytes = static_cast<const uint8_t*>(raw);
+                   request->data = std::make_shared<const std::vector<uint8_t>>(bytes, bytes + size);
+                   SDL_free(raw);
+               },
+               [this, request, key, path]()
+               {
+                   m_fileRequests.erase(key);
+                   if (!request->data)
+                   {
+                       LOG_ERROR("AssetLoader: Failed to read '{}'", path);
+                   }
+
+                   bool succeeded = true;
+                   for (auto& callback : request->callbacks)
+                   {
+                       succeeded = callback(request->data) && succeeded;
+                   }
+                   return succeeded;
+               });
+    }
+
+    int AssetLoader::Update(const uint64_t budgetNs)
+    {
+        const uint64_t start = SDL_GetTicksNS();
+        int completed = 0;
+
+        Task task;
+        while (PopReady(task, false))
+        {
+            Finalize(task);
+            ++completed;
+
+            if (SDL_GetTicksNS() - start >= budgetNs)
+            {
+                break;
+            }
+        }
+        return completed;
+    }
+
+    bool AssetLoader::WaitForCritical()
+    {
+        const uint64_t start = SDL_GetTicksNS();
+        Drain(m_outstandingCritical);
+        LOG_INFO("AssetLoader: Critical assets ready in {:.1f}ms ({} task(s) still loading)",
+                 static_cast<double>(SDL_GetTicksNS() - start) / 1'000'000.0, m_outstanding);
+        return !m_criticalFailed;
+    }
+
+    bool AssetLoader::WaitForAll()
+    {
+        Drain(m_outstanding);
+        return !m_anyFailed;
+    }
+
+    void AssetLoader::WorkerLoop()
+    {
+        while (true)
+        {
+            Task task;
+            {
+                std::unique_lock lock(m_pendingMutex);
+                m_pendingCondition.wait(lock, [this]()
+                {
+                    return m_stopping || !m_pendingCritical.empty() || !m_pendingDeferred.empty();
+                });
+                if (m_stopping)
+                {
+                    return;
+                }
+
+                auto& queue = m_pendingCritical.empty() ? m_pendingDeferred : m_pendingCritical;
+                task = std::move(queue.front());
+                queue.pop_front();
+            }
+
+            task.work();
+            PushReady(std::move(task));
+        }
+    }
+
+    void AssetLoader::PushReady(Task task)
+    {
+        {
+            std::lock_guard lock(m_readyMutex);
+            auto& queue = task.priority == Priority::Critical ? m_readyCritical : m_readyDeferred;
+            queue.push_back(std::move(task));
+        }
+        m_readyCondition.notify_one();
+    }
+
+    bool AssetLoader::PopReady(Task& task, const bool wait)
+    {
+        std::unique_lock lock(m_readyMutex);
+        if (wait)
+        {
+            m_readyCondition.wait(lock, [this]()
+            {
+                return !m_readyCritical.empty() || !m_readyDeferred.empty();
+            });
+        }
+
+        auto& queue = m_readyCritical.empty() ? m_readyDeferred : m_readyCritical;
+        if (queue.empty())
+        {
+            return false;
+        }
+
+        task = std::move(queue.front());
+        queue.pop_front();
+        return true;
+    }
+
+    void AssetLoader::Finalize(Task& task)
+    {
+        const bool succeeded = !task.finalize || task.finalize();
+        if (!succeeded)
+        {
+            m_anyFailed = true;
+            if (task.priority == Priority::Critical)
+            {
+                m_criticalFailed = true;
+            }
+            LOG_ERROR("AssetLoader: Failed to load '{}'", task.name);
+        }
+
+        --m_outstanding;
+        if (task.priority == Priority::Critical)
+        {
+            --m_outstandingCritical;
+        }
+    }
+
+    void AssetLoader::Drain(const int& remaining)
+    {
+        Task task;
+        while (remaining > 0 && PopReady(task, true))
+        {
+            Finalize(task);
+        }
+    }
+} // namespace Match3
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <ankerl/unordered_dense.h>
+
+namespace Match3
+{
+    /**
+     * @brief 异步资源加载器 - 工作线程读文件/解码，渲染线程分片上传
+     *
+     * 每个任务分两步：
+     * - work：在工作线程上执行（读文件、光栅化等纯 CPU 操作，不能碰 SDL 渲染器）
+     * - finalize：在渲染线程上执行（创建纹理、注册字体），由 Update() 按时间预算分片调用
+     *
+     * Critical 任务先于 Deferred 任务完成；启动时只需 WaitForCritical()，
+     * 其余资源在之后的帧里陆续就绪。
+     */
+    class AssetLoader
+    {
+    public:
+        enum class Priority
+        {
+            Critical, // 首个场景必需
+            Deferred  // 可在首帧之后就绪
+        };
+
+        using FileData = std::shared_ptr<const std::vector<uint8_t>>;
+        using WorkFn = std::function<void()>;
+        using FinalizeFn = std::function<bool()>;
+        using FileCallback = std::function<bool(const FileData&)>;
+
+        /**
+         * @param workerCount 工作线程数，0 表示按 CPU 核心数自动选择
+         */
+        explicit AssetLoader(int workerCount = 0);
+        ~AssetLoader();
+
+        AssetLoader(const AssetLoader&) = delete;
+        AssetLoader& operator=(const AssetLoader&) = delete;
+
+        /**
+         * @brief 提交任务（只能在渲染线程调用）
+         * @param name 任务名（日志用）
+         * @param work 工作线程步骤，可为空（只有渲染线程步骤）
+         * @param finalize 渲染线程步骤，返回 false 表示加载失败
+         */
+        void Submit(std::string name, Priority priority, WorkFn work, FinalizeFn finalize);
+
+        /**
+         * @brief 异步读取文件，完成后在渲染线程回调
+         *
+         * 同一路径在读取完成前重复请求只读一次，所有回调共享同一份数据。
+         * 读取失败时回调收到空指针。
+         */
+        void LoadFile(const std::string& path, Priority priority, FileCallback onLoaded);
+
+        /**
+         * @brief 在渲染线程执行已就绪的 finalize 步骤，直到用完时间预算（至少执行一个）
+         * @return 本次完成的任务数
+         */
+        int Update(uint64_t budgetNs);
+
+        /**
+         * @brief 阻塞直到所有 Critical 任务完成
+         * @return 全部成功返回 true
+         */
+        bool WaitForCritical();
+
+        /**
+         * @brief 阻塞直到所有任务完成
+         * @return 全部成功返回 true
+         */
+        bool WaitForAll();
+
+        /**
+         * @brief 是否还有未完成的任务
+         */
+        [[nodiscard]] bool IsBusy() const { return m_outstanding > 0; }
+
+    private:
+        struct Task
+        {
+            std::string name;
+            Priority priority = Priority::Deferred;
+            WorkFn work;
+            FinalizeFn finalize;
+        };
+
+        struct FileRequest
+        {
+            FileData data;
+            std::vector<FileCallback> callbacks;
+        };
+
+        void WorkerLoop();
+
+        /**
+         * @brief 取出一个已就绪任务（Critical 优先），没有时返回 false
+         */
+        bool PopReady(Task& task, bool wait);
+
+        /**
+         * @brief 在渲染线程上完成一个任务
+         */
+        void Finalize(Task& task);
+
+        /**
+         * @brief 把任务放入就绪队列
+         */
+        void PushReady(Task task);
+
+        /**
+         * @brief 在渲染线程上执行就绪任务，直到计数器归零
+         */
+        void Drain(const int& remaining);
+
+        std::vector<std::thread> m_workers;
+        bool m_stopping = false;
+
+        // 待执行 work 的任务（工作线程取用，Critical 优先）
+        std::mutex m_pendingMutex;
+        std::condition_variable m_pendingCondition;
+        std::deque<Task> m_pendingCritical;
+        std::deque<Task> m_pendingDeferred;
+
+        // work 已完成、等待 finalize 的任务（渲染线程取用）
+        std::mutex m_readyMutex;
+        std::condition_variable m_readyCondition;
+        std::deque<Task> m_readyCritical;
+        std::deque<Task> m_readyDeferred;
+
+        // 以下只在渲染线程访问
+        ankerl::unordered_dense::map<std::string, std::shared_ptr<FileRequest>> m_fileRequests;
+        int m_outstanding = 0;
+        int m_outstandingCritical = 0;
+        bool m_criticalFailed = false;
+        bool m_anyFailed = false;
+    };
+} // namespace Match3
@@ -12,6 +12,7 @@ namespace Match3
     GameStateManager::GameStateManager(Renderer* renderer)
         : m_renderer(renderer)
     {
+        m_latches = std::make_unique<Systems::AnimationLatches>(m_dispatcher);
         m_factory = std::make_unique<EntityFactory>(m_registry);
         m_systemManager = std::make_unique<SystemManager>();
     }
@@ -26,11 +27,16 @@ namespace Match3
         m_cols = cols;
         m_gemTypes = gemTypes;
 
+        // 重复初始化时先释放旧的系统和实体
+        DiscardPendingWork();
+        m_systemManager->Clear();
+        m_registry.clear();
+
         // 创建所有系统
         auto boardSystem = std::make_shared<Systems::BoardSystem>(rows, cols, *m_factory);
         auto matchSystem = std::make_shared<Systems::MatchDetectionSystem>(*boardSystem);
-        auto swapSystem = std::make_shared<Systems::SwapSystem>(*boardSystem, *matchSystem);
-        auto animSystem = std::make_shared<Systems::AnimationSystem>();
+        auto swapSystem = std::make_shared<Systems::SwapSystem>(*boardSystem, *matchSystem, *m_latches);
+        auto animSystem = std::make_shared<Systems::AnimationSystem>(m_dispatcher);
         auto particleSystem = std::make_shared<Systems::ParticleSystem>();
         auto lifetimeSystem = std::make_shared<Systems::LifetimeSystem>();
         auto renderSystem = std::make_shared<Systems::RenderSystem>(m_renderer);
@@ -41,6 +47,7 @@ namespace Match3
         m_swapSystem = swapSystem.get();
         m_animSystem = animSystem.get();
         m_renderSystem = renderSystem.get(); // 保存RenderSystem引用
+        m_renderSystem->SetViewport(m_renderViewport);
 
         // 设置回调
         m_swapSystem->SetSwapCallback([this](bool valid)
@@ -52,6 +59,7 @@ namespace Match3
         m_systemManager->AddSystem(animSystem);
         m_systemManager->AddSystem(particleSystem);
         m_systemManager->AddSystem(lifetimeSystem);
+        m_systemManager->AddSyncPoint(); // 动画/粒子/生命周期的结构变更对棋盘逻辑可见
         m_systemManager->AddSystem(boardSystem);
         m_systemManager->AddSystem(matchSystem);
         m_systemManager->AddSystem(swapSystem);
@@ -62,6 +70,8 @@ namespace Match3
 
         // 初始化棋盘
         m_boardSystem->InitializeBoard(m_registry, gemTypes);
+        m_initialSnapshot.Capture(m_registry, *m_boardSystem);
+        m_checkpoint.Invalidate(); // 旧棋盘的存档点不能载入新棋盘
 
         LOG_INFO("GameStateManager: Initialized with {} systems", m_systemManager->GetSystemCount());
 
@@ -85,15 +95,13 @@ namespace Match3
         case ECSPlayState::Matching:
             UpdateMatchingState(deltaTime);
             break;
-        case ECSPlayState::Eliminating:
-            UpdateEliminatingState(deltaTime);
-            break;
         case ECSPlayState::Falling:
             UpdateFallingState(deltaTime);
             break;
         case ECSPlayState::Filling:
             UpdateFillingState(deltaTime);
             break;
+        case ECSPlayState::Eliminating: // 由动画组闭锁回调推进
         case ECSPlayState::GameOver:
         case ECSPlayState::Paused:
             // 这些状态不自动更新
@@ -102,6 +110,27 @@ namespace Match3
 
         // 更新所有系统
         m_systemManager->UpdateAll(m_registry, deltaTime);
+
+        // 派发本帧的动画完成事件（闭锁回调在同一帧内推进状态机）
+        m_dispatcher.update();
+
+        // 事件同步点：回调记录的结构变更在本帧内生效
+        m_systemManager->FlushCommands(m_registry);
+    }
+
+    bool GameStateManager::IsAnimating()
+    {
+        if (m_currentState != ECSPlayState::Idle)
+        {
+            return true;
+        }
+
+        return !m_registry.view<Components::TweenAnimation>().empty()
+            || !m_registry.view<Components::ScaleAnimation>().empty()
+            || !m_registry.view<Components::FadeAnimation>().empty()
+            || !m_registry.view<Components::RotationAnimation>().empty()
+            || !m_registry.view<Components::PulseAnimation>().empty()
+            || !m_registry.view<Components::Particle>().empty();
     }
 
     void GameStateManager::Render()
@@ -113,6 +142,29 @@ namespace Match3
         }
     }
 
+    void GameStateManager::SetRenderViewport(const SDL_FRect& viewport)
+    {
+        m_renderViewport = viewport;
+        if (m_renderSystem)
+        {
+            m_renderSystem->SetViewport(viewport);
+        }
+    }
+
+    Systems::RenderSystem::FrameStats GameStateManager::GetRenderSystemStats() const
+    {
+        return m_renderSystem ? m_renderSystem->GetFrameStats() : Systems::RenderSystem::FrameStats{};
+    }
+
+    void GameStateManager::RenderInterpolated(const Systems::RenderSnapshot& previous,
+                                              const Systems::RenderSnapshot& current, float alpha)
+    {
+        if (m_renderSystem)
+        {
+            m_renderSystem->RenderInterpolated(previous, current, alpha);
+        }
+    }
+
     void GameStateManager::HandleClick(int row, int col)
     {
         // 只在Idle状态处理点击
@@ -165,15 +217,89 @@ namespace Match3
     {
         LOG_INFO("GameStateManager: Resetting game");
 
-        // 清除所有实体
-        m_registry.clear();
+        DiscardPendingWork();
+        m_checkpoint.Invalidate();
 
-        // 重新初始化棋盘
+        // 重新发一副随机棋盘，并作为新的开局快照
+        m_registry.clear();
         m_boardSystem->InitializeBoard(m_registry, m_gemTypes);
+        m_initialSnapshot.Capture(m_registry, *m_boardSystem);
 
         StartNewGame();
     }
 
+    void GameStateManager::RestartFromInitialBoard()
+    {
+        LOG_INFO("GameStateManager: Restarting from the initial board");
+
+        DiscardPendingWork();
+        m_checkpoint.Invalidate();
+
+        // 从开局快照原地恢复，快照不可用时退回重新发牌
+        if (!m_initialSnapshot.Restore(m_registry, *m_boardSystem))
+        {
+            m_registry.clear();
+            m_boardSystem->InitializeBoard(m_registry, m_gemTypes);
+            m_initialSnapshot.Capture(m_registry, *m_boardSystem);
+        }
+
+        StartNewGame();
+    }
+
+    bool GameStateManager::SaveCheckpoint()
+    {
+        if (m_currentState != ECSPlayState::Idle || m_swapSystem->HasPendingSwaps())
+        {
+            LOG_WARN("GameStateManager: Checkpoints can only be saved while idle");
+            return false;
+        }
+
+        m_checkpoint.Capture(m_registry, *m_boardSystem);
+        m_checkpointData = {m_score, m_moves, m_combo, m_selectedRow, m_selectedCol, m_hasSelection};
+
+        LOG_INFO("GameStateManager: Checkpoint saved ({} entities)", m_checkpoint.GetEntityCount());
+        return true;
+    }
+
+    bool GameStateManager::LoadCheckpoint()
+    {
+        // 先检查再丢弃进行中的工作，拒绝时当前对局保持原样
+        if (!m_checkpoint.CanRestore(*m_boardSystem))
+        {
+            LOG_WARN("GameStateManager: No checkpoint to load for this board");
+            return false;
+        }
+
+        DiscardPendingWork();
+
+        if (!m_checkpoint.Restore(m_registry, *m_boardSystem))
+        {
+            return false;
+        }
+
+        m_score = m_checkpointData.score;
+        m_moves = m_checkpointData.moves;
+        m_combo = m_checkpointData.combo;
+        m_selectedRow = m_checkpointData.selectedRow;
+        m_selectedCol = m_checkpointData.selectedCol;
+        m_hasSelection = m_checkpointData.hasSelection;
+        SetState(ECSPlayState::Idle);
+
+        LOG_INFO("GameStateManager: Checkpoint loaded");
+        return true;
+    }
+
+    void GameStateManager::DiscardPendingWork()
+    {
+        if (m_swapSystem)
+        {
+            m_swapSystem->ClearPendingSwaps();
+        }
+        m_latches->Clear();
+        m_dispatcher.clear();
+        m_systemManager->GetCommandBuffer().Clear();
+    }
+
     void GameStateManager::UpdateIdleState(float dt)
     {
         // 在Idle状态，等待玩家输入
@@ -220,84 +346,34 @@ namespace Match3
             }
             AddScore(totalGems);
 
-            // 开始消除动画
-            for (const auto& match : matches)
-            {
-                for (auto entity : match.gems)
-                {
-                    // 检查实体是否有效
-                    if (!m_registry.valid(entity))
-                    {
-                        continue;
-                    }
-
-                    // 添加消除动画（缩放到0 + 淡出）
-                    // 使用emplace_or_replace避免重复添加导致崩溃
-                    m_registry.emplace_or_replace<Components::ScaleAnimation>(entity,
-                                                                              Config::ELIMINATION_DURATION, 1.0f, 0.0f,
-                                                                              Components::EasingType::InQuad);
-
-                    m_registry.emplace_or_replace<Components::FadeAnimation>(entity,
-                                                                             Config::ELIMINATION_DURATION, 1.0f, 0.0f,
-                                                                             Components::EasingType::Linear);
-
-                    // 添加旋转动画
-                    m_registry.emplace_or_replace<Components::RotationAnimation>(entity,
-                        Config::ELIMINATION_DURATION, 0.0f, 6.28f,
-                        Components::EasingType::Linear);
-                }
-            }
-
+            // 先进入消除状态：计数为0时闭锁会立即回调并切换到下落状态
             SetState(ECSPlayState::Eliminating);
-        }
-    }
-
-    void GameStateManager::UpdateEliminatingState(float dt)
-    {
-        // 检查消除动画是否完成
-        // 如果所有Matched的宝石都没有动画组件，说明动画完成
-        auto view = m_registry.view<Components::Matched>();
 
-        bool allAnimationsComplete = true;
-        for (auto entity : view)
-        {
-            if (m_registry.all_of<Components::ScaleAnimation>(entity) ||
-                m_registry.all_of<Components::FadeAnimation>(entity) ||
-                m_registry.all_of<Components::RotationAnimation>(entity))
-            {
-                allAnimationsComplete = false;
-                break;
-            }
-        }
+            // 开始消除动画（同一宝石可能属于多个匹配组，按Matched去重）
+            auto matchedView = m_registry.view<Components::Matched>();
 
-        if (allAnimationsComplete)
-        {
-            // 销毁匹配的宝石
-            std::vector<entt::entity> toDestroy;
-            for (auto entity : view)
-            {
-                toDestroy.push_back(entity);
-            }
+            // 每个宝石3个动画，全部完成后回调一次
+            const uint32_t group = m_latches->Create(
+                static_cast<uint32_t>(matchedView.size()) * 3,
+                [this] { OnEliminationComplete(); });
 
-            for (auto entity : toDestroy)
+            for (auto entity : matchedView)
             {
-                // 从网格中移除（将位置设为null）
-                if (m_registry.all_of<Components::GridPosition>(entity))
-                {
-                    const auto& gridPos = m_registry.get<Components::GridPosition>(entity);
-                    // BoardSystem会在下次RebuildGridIndex时更新
-                }
-
-                m_registry.destroy(entity);
+                // 添加消除动画（缩放到0 + 淡出）
+                // 使用emplace_or_replace避免重复添加导致崩溃
+                m_registry.emplace_or_replace<Components::ScaleAnimation>(entity,
+                                                                          Config::ELIMINATION_DURATION, 1.0f, 0.0f,
+                                                                          Components::EasingType::InQuad).group = group;
+
+                m_registry.emplace_or_replace<Components::FadeAnimation>(entity,
+                                                                         Config::ELIMINATION_DURATION, 1.0f, 0.0f,
+                                                                         Components::EasingType::Linear).group = group;
+
+                // 添加旋转动画
+                m_registry.emplace_or_replace<Components::RotationAnimation>(entity,
+                    Config::ELIMINATION_DURATION, 0.0f, 6.28f,
+                    Components::EasingType::Linear).group = group;
             }
-
-            LOG_DEBUG("GameStateManager: Eliminated {} gems", toDestroy.size());
-
-            // 重建网格索引
-            m_boardSystem->RebuildGridIndex(m_registry);
-
-            // 进入下落状态
-            SetState(ECSPlayState::Falling);
         }
     }
 
@@ -538,42 +614,43 @@ namespace Match3
         }
     }
 
-    void GameStateManager::ClearAllSelectionAnimations()
+    void GameStateManager::OnEliminationComplete()
     {
-        // 清除所有Selected组件
-        auto selectedView = m_registry.view<Components::Selected>();
-        std::vector<entt::entity> toRemove;
-        for (auto entity : selectedView)
+        // 销毁匹配的宝石
+        auto& commands = m_systemManager->GetCommandBuffer();
+        auto view = m_registry.view<Components::Matched>();
+        for (auto entity : view)
         {
-            toRemove.push_back(entity);
+            commands.Destroy(entity);
         }
-        for (auto entity : toRemove)
+        LOG_DEBUG("GameStateManager: Eliminating {} gems", view.size());
+
+        // 重建网格索引（已匹配的宝石不再入索引，销毁在事件同步点回放）
+        m_boardSystem->RebuildGridIndex(m_registry);
+
+        // 进入下落状态
+        SetState(ECSPlayState::Falling);
+    }
+
+    void GameStateManager::ClearAllSelectionAnimations()
+    {
+        auto& commands = m_systemManager->GetCommandBuffer();
+
+        // 清除所有Selected组件
+        for (auto entity : m_registry.view<Components::Selected>())
         {
-            if (m_registry.valid(entity))
-            {
-                m_registry.remove<Components::Selected>(entity);
-            }
+            commands.Remove<Components::Selected>(entity);
         }
 
         // 清除所有PulseAnimation组件，并重置scale
-        auto pulseView = m_registry.view<Components::PulseAnimation>();
-        toRemove.clear();
-        for (auto entity : pulseView)
+        for (auto entity : m_registry.view<Components::PulseAnimation>())
         {
-            toRemove.push_back(entity);
-        }
-        for (auto entity : toRemove)
-        {
-            if (m_registry.valid(entity))
+            // 重置scale为1.0，避免宝石大小异常
+            if (auto* render = m_registry.try_get<Components::Renderable>(entity))
             {
-                // 重置scale为1.0，避免宝石大小异常
-                if (m_registry.all_of<Components::Renderable>(entity))
-                {
-                    auto& render = m_registry.get<Components::Renderable>(entity);
-                    render.scale = 1.0f;
-                }
-                m_registry.remove<Components::PulseAnimation>(entity);
+                render->scale = 1.0f;
             }
+            commands.Remove<Components::PulseAnimation>(entity);
         }
 
         LOG_DEBUG("GameStateManager: Cleared all selection animations");
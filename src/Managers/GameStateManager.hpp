@@ -3,11 +3,13 @@
 #include <entt/entt.hpp>
 #include <memory>
 #include "Managers/SystemManager.hpp"
+#include "Managers/RegistrySnapshot.hpp"
 #include "Factories/EntityFactory.hpp"
 #include "Systems/BoardSystem.hpp"
 #include "Systems/MatchDetectionSystem.hpp"
 #include "Systems/SwapSystem.hpp"
 #include "Systems/AnimationSystem.hpp"
+#include "Systems/AnimationLatches.hpp"
 #include "Systems/RenderSystem.hpp"
 #include "Render/Renderer.hpp"
 
@@ -62,6 +64,28 @@ namespace Match3
          */
         void Render();
 
+        /**
+         * @brief 按渲染快照插值渲染（模拟线程模式，不访问注册表）
+         */
+        void RenderInterpolated(const Systems::RenderSnapshot& previous,
+                                const Systems::RenderSnapshot& current, float alpha);
+
+        /**
+         * @brief 设置渲染剔除视口（场景逻辑坐标），重新初始化后保持
+         */
+        void SetRenderViewport(const SDL_FRect& viewport);
+
+        /**
+         * @brief 最近一帧的实体绘制与剔除统计
+         */
+        [[nodiscard]] Systems::RenderSystem::FrameStats GetRenderSystemStats() const;
+
+        /**
+         * @brief 画面是否仍在变化（非空闲状态、有动画或粒子）
+         * 用于损伤跟踪模式判断能否跳过渲染
+         */
+        [[nodiscard]] bool IsAnimating();
+
         /**
          * @brief 处理玩家点击
          * @param row 行
@@ -75,10 +99,29 @@ namespace Match3
         void StartNewGame();
 
         /**
-         * @brief 重置游戏
+         * @brief 重置游戏（重新发一副随机棋盘，不重建系统）
          */
         void Reset();
 
+        /**
+         * @brief 重新开始同一局（从开局快照原地恢复，供自动化测试使用）
+         */
+        void RestartFromInitialBoard();
+
+        /**
+         * @brief 保存检查点（仅在Idle状态且没有进行中的交换时可用）
+         * @return 是否保存成功
+         */
+        bool SaveCheckpoint();
+
+        /**
+         * @brief 恢复到最近一次保存的检查点（重新开局或重新初始化后检查点失效）
+         * @return 没有可用检查点时返回false，当前对局不受影响
+         */
+        bool LoadCheckpoint();
+
+        [[nodiscard]] bool HasCheckpoint() const { return m_checkpoint.IsValid(); }
+
         // Getters
         [[nodiscard]] ECSPlayState GetPlayState() const { return m_currentState; }
         [[nodiscard]] int GetScore() const { return m_score; }
@@ -89,6 +132,8 @@ namespace Match3
     private:
         // ECS核心
         entt::registry m_registry;
+        entt::dispatcher m_dispatcher; // 动画完成等事件，在系统更新后派发
+        std::unique_ptr<Systems::AnimationLatches> m_latches;
         std::unique_ptr<EntityFactory> m_factory;
         std::unique_ptr<SystemManager> m_systemManager;
 
@@ -98,6 +143,8 @@ namespace Match3
         Systems::SwapSystem* m_swapSystem = nullptr;
         Systems::AnimationSystem* m_animSystem = nullptr;
         Systems::RenderSystem* m_renderSystem = nullptr;
+        SDL_FRect m_renderViewport = {0.0f, 0.0f, static_cast<float>(Display::ViewportManager::GAME_WIDTH),
+                                      static_cast<float>(Display::ViewportManager::GAME_HEIGHT)};
 
         // 游戏状态
         ECSPlayState m_currentState = ECSPlayState::Idle;
@@ -119,11 +166,25 @@ namespace Match3
         // 渲染器
         Renderer* m_renderer = nullptr;
 
+        // 快照
+        struct CheckpointData
+        {
+            int score = 0;
+            int moves = 0;
+            int combo = 0;
+            int selectedRow = -1;
+            int selectedCol = -1;
+            bool hasSelection = false;
+        };
+
+        RegistrySnapshot m_initialSnapshot; // 开局棋盘
+        RegistrySnapshot m_checkpoint;
+        CheckpointData m_checkpointData;
+
         // 状态更新函数
         void UpdateIdleState(float dt);
         void UpdateSwappingState(float dt);
         void UpdateMatchingState(float dt);
-        void UpdateEliminatingState(float dt);
         void UpdateFallingState(float dt);
         void UpdateFillingState(float dt);
 
@@ -135,8 +196,10 @@ namespace Match3
         void TrySwap(int row, int col);
         void ProcessMatches();
         void AddScore(int matchCount);
+        void DiscardPendingWork(); // 丢弃未完成的交换、动画组、事件和命令
 
         // 回调
         void OnSwapComplete(bool valid);
+        void OnEliminationComplete();
     };
 } // namespace Match3
@@ -0,0 +1,138 @@
+#include "RegistrySnapshot.hpp"
+#include "Systems/BoardSystem.hpp"
+#include "Core/Logger.hpp"
+#include <algorithm>
+
+namespace Match3
+{
+    void RegistrySnapshot::Capture(entt::registry& registry, const Systems::BoardSystem& board)
+    {
+        m_entities.clear();
+
+        std::apply([&](auto&... pools)
+        {
+            ([&](auto& pool)
+            {
+                using T = typename std::decay_t<decltype(pool.components)>::value_type;
+                auto view = registry.view<T>();
+
+                pool.entities.assign(view.begin(), view.end());
+                pool.components.clear();
+                pool.components.reserve(pool.entities.size());
+                for (auto entity : pool.entities)
+                {
+                    pool.components.push_back(view.template get<T>(entity));
+                }
+
+                m_entities.insert(m_entities.end(), pool.entities.begin(), pool.entities.end());
+            }(pools), ...);
+        }, m_pools);
+
+        // 所有实体 = 各组件实体的并集（没有任何组件的实体无需保存）
+        std::sort(m_entities.begin(), m_entities.end());
+        m_entities.erase(std::unique(m_entities.begin(), m_entities.end()), m_entities.end());
+
+        board.ExportGrid(m_grid);
+        m_rows = board.GetRows();
+        m_cols = board.GetCols();
+        m_valid = true;
+
+        LOG_DEBUG("RegistrySnapshot: Captured {} entities ({} bytes)", m_entities.size(), GetByteSize());
+    }
+
+    bool RegistrySnapshot::CanRestore(const Systems::BoardSystem& board) const
+    {
+        return m_valid && m_rows == board.GetRows() && m_cols == board.GetCols() &&
+               m_grid.size() == static_cast<size_t>(m_rows) * m_cols;
+    }
+
+    bool RegistrySnapshot::Restore(entt::registry& registry, Systems::BoardSystem& board)
+    {
+        if (!m_valid)
+        {
+            LOG_WARN("RegistrySnapshot: Restore called on an empty snapshot");
+            return false;
+        }
+        if (!CanRestore(board))
+        {
+            LOG_WARN("RegistrySnapshot: Snapshot of a {}x{} board does not match the {}x{} board",
+                     m_rows, m_cols, board.GetRows(), board.GetCols());
+            return false;
+        }
+
+        // clear() 只销毁实体与组件，各存储的容量保留
+        registry.clear();
+
+        // 按原ID重建实体；ID被占用时记录重映射
+        m_remap.clear();
+        for (auto entity : m_entities)
+        {
+            const auto created = registry.create(entity);
+            if (created != entity)
+            {
+                m_remap.emplace(entity, created);
+            }
+        }
+
+        std::apply([&](auto&... pools)
+        {
+            ([&](auto& pool)
+            {
+                using T = typename std::decay_t<decltype(pool.components)>::value_type;
+                if (pool.entities.empty())
+                {
+                    return;
+                }
+
+                if (m_remap.empty())
+                {
+                    registry.insert<T>(pool.entities.begin(), pool.entities.end(), pool.components.begin());
+                }
+                else
+                {
+                    m_remapped.clear();
+                    for (auto entity : pool.entities)
+                    {
+                        m_remapped.push_back(Remap(entity));
+                    }
+                    registry.insert<T>(m_remapped.begin(), m_remapped.end(), pool.components.begin());
+                }
+            }(pools), ...);
+        }, m_pools);
+
+        if (m_remap.empty())
+        {
+            return board.ImportGrid(m_grid);
+        }
+
+        LOG_DEBUG("RegistrySnapshot: Remapped {} entity ids", m_remap.size());
+        m_remapped.clear();
+        for (auto entity : m_grid)
+        {
+            m_remapped.push_back(Remap(entity));
+        }
+        return board.ImportGrid(m_remapped);
+    }
+
+    size_t RegistrySnapshot::GetByteSize() const
+    {
+        size_t bytes = (m_entities.size() + m_grid.size()) * sizeof(entt::entity);
+        std::apply([&](const auto&... pools)
+        {
+            ((bytes += pools.entities.size() * sizeof(entt::entity)
+                       + pools.components.size() * sizeof(typename std::decay_t<decltype(pools.components)>::value_type)), ...);
+        }, m_pools);
+        return bytes;
+    }
+
+    entt::entity RegistrySnapshot::Remap(entt::entity entity) const
+    {
+        if (entity == entt::null)
+        {
+            return entity;
+        }
+
+        const auto it = m_remap.find(entity);
+        return it != m_remap.end() ? it->second : entity;
+    }
+} // namespace Match3
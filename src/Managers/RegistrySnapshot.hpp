@@ -0,0 +1,105 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <ankerl/unordered_dense.h>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "Components/Common.hpp"
+#include "Components/Gem.hpp"
+#include "Components/Animation.hpp"
+#include "Components/Particle.hpp"
+
+namespace Match3
+{
+    namespace Systems
+    {
+        class BoardSystem;
+    }
+
+    /**
+     * @brief 注册表快照 - 保存所有实体、组件和棋盘网格索引
+     *
+     * 每种组件保存为一对连续数组（实体数组 + 组件数组），恢复时先 clear()
+     * 注册表（保留各存储的容量），按原ID重建实体，再整段 insert 组件，
+     * 不经过 EntityFactory，也不重新分配系统。
+     *
+     * 快照的缓冲区在多次 Capture() 之间复用。
+     */
+    class RegistrySnapshot
+    {
+    public:
+        /**
+         * @brief 捕获注册表与棋盘网格
+         */
+        void Capture(entt::registry& registry, const Systems::BoardSystem& board);
+
+        /**
+         * @brief 快照有效且棋盘尺寸与捕获时一致
+         */
+        [[nodiscard]] bool CanRestore(const Systems::BoardSystem& board) const;
+
+        /**
+         * @brief 原地恢复（注册表会被清空）
+         *
+         * 全部检查在清空注册表之前完成：失败时注册表和棋盘保持不变。
+         * @return 快照为空或棋盘尺寸不匹配时返回false
+         */
+        bool Restore(entt::registry& registry, Systems::BoardSystem& board);
+
+        /**
+         * @brief 丢弃快照（例如棋盘重新开局后旧快照不再适用）
+         */
+        void Invalidate() { m_valid = false; }
+
+        [[nodiscard]] bool IsValid() const { return m_valid; }
+        [[nodiscard]] size_t GetEntityCount() const { return m_entities.size(); }
+
+        /**
+         * @brief 快照占用的字节数（不含 vector 自身）
+         */
+        [[nodiscard]] size_t GetByteSize() const;
+
+    private:
+        template <typename T>
+        struct Pool
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Snapshot components must be trivially copyable");
+
+            std::vector<entt::entity> entities;
+            std::vector<T> components;
+        };
+
+        // 新增组件类型时需要加入这里
+        using Pools = std::tuple<
+            Pool<Components::Position>,
+            Pool<Components::GridPosition>,
+            Pool<Components::Velocity>,
+            Pool<Components::Renderable>,
+            Pool<Components::Lifetime>,
+            Pool<Components::Gem>,
+            Pool<Components::Matched>,
+            Pool<Components::Selected>,
+            Pool<Components::Particle>,
+            Pool<Components::ExplosionEffect>,
+            Pool<Components::SparkleEffect>,
+            Pool<Components::TweenAnimation>,
+            Pool<Components::ScaleAnimation>,
+            Pool<Components::FadeAnimation>,
+            Pool<Components::RotationAnimation>,
+            Pool<Components::PulseAnimation>>;
+
+        std::vector<entt::entity> m_entities; // 所有实体（升序，去重）
+        std::vector<entt::entity> m_grid;     // 行优先的网格索引
+        int m_rows = 0;                       // 捕获时的棋盘尺寸
+        int m_cols = 0;
+        Pools m_pools;
+        bool m_valid = false;
+
+        // 恢复时的临时缓冲（实体ID不一致时用于重映射）
+        ankerl::unordered_dense::map<entt::entity, entt::entity> m_remap;
+        std::vector<entt::entity> m_remapped;
+
+        entt::entity Remap(entt::entity entity) const;
+    };
+} // namespace Match3
@@ -0,0 +1,157 @@
+#include "SimulationThread.hpp"
+#include "GameStateManager.hpp"
+#include "Core/Logger.hpp"
+#include "Systems/RenderSystem.hpp"
+#include <SDL3/SDL_timer.h>
+#include <algorithm>
+
+namespace Match3
+{
+    namespace
+    {
+        // 落后超过该时长时放弃追赶（避免螺旋死亡）
+        constexpr uint64_t MAX_CATCH_UP_NS = 250'000'000;
+    }
+
+    SimulationThread::SimulationThread(GameStateManager& gameState, float timestep)
+        : m_gameState(gameState)
+          , m_timestepNS(static_cast<uint64_t>(static_cast<double>(timestep) * 1'000'000'000.0))
+    {
+    }
+
+    SimulationThread::~SimulationThread()
+    {
+        Stop();
+    }
+
+    void SimulationThread::Start()
+    {
+        if (IsRunning())
+        {
+            return;
+        }
+
+        // 线程启动前发布初始状态，渲染线程第一帧就有内容
+        Publish(true);
+        Publish(true);
+
+        m_running.store(true, std::memory_order_release);
+        m_thread = std::thread(&SimulationThread::Run, this);
+
+        LOG_INFO("SimulationThread: Started ({:.2f}ms step)", m_timestepNS / 1'000'000.0);
+    }
+
+    void SimulationThread::Stop()
+    {
+        if (!m_thread.joinable())
+        {
+            return;
+        }
+
+        m_running.store(false, std::memory_order_release);
+        m_thread.join();
+
+        LOG_INFO("SimulationThread: Stopped after {} steps", m_tick);
+    }
+
+    void SimulationThread::Post(Command command, bool discontinuous)
+    {
+        std::lock_guard lock(m_commandMutex);
+        m_pendingCommands.push_back({std::move(command), discontinuous});
+    }
+
+    float SimulationThread::ReadSnapshots(const Systems::RenderSnapshot*& previous,
+                                          const Systems::RenderSnapshot*& current)
+    {
+        uint64_t publishNS;
+        {
+            // 只借出索引，上一次借出的缓冲随之归还
+            std::lock_guard lock(m_snapshotMutex);
+            m_readPrevious = m_previous;
+            m_readLatest = m_latest;
+            publishNS = m_latestPublishNS;
+        }
+
+        previous = &m_snapshots[m_readPrevious];
+        current = &m_snapshots[m_readLatest];
+
+        const uint64_t now = SDL_GetTicksNS();
+        const uint64_t sincePublish = now > publishNS ? now - publishNS : 0;
+        return std::clamp(static_cast<float>(sincePublish) / static_cast<float>(m_timestepNS), 0.0f, 1.0f);
+    }
+
+    void SimulationThread::Run()
+    {
+        const float timestep = static_cast<float>(m_timestepNS) / 1'000'000'000.0f;
+        uint64_t nextStep = SDL_GetTicksNS();
+
+        while (m_running.load(std::memory_order_acquire))
+        {
+            const bool discontinuous = ExecuteCommands();
+
+            m_gameState.Update(timestep);
+            ++m_tick;
+            Publish(discontinuous);
+
+            // 等待下一步
+            nextStep += m_timestepNS;
+            const uint64_t now = SDL_GetTicksNS();
+            if (now > nextStep + MAX_CATCH_UP_NS)
+            {
+                LOG_WARN("SimulationThread: Fell behind by {:.1f}ms, skipping ahead",
+                         (now - nextStep) / 1'000'000.0);
+                nextStep = now;
+            }
+            else if (nextStep > now)
+            {
+                SDL_DelayNS(nextStep - now);
+            }
+        }
+    }
+
+    bool SimulationThread::ExecuteCommands()
+    {
+        {
+            std::lock_guard lock(m_commandMutex);
+            m_executingCommands.swap(m_pendingCommands);
+        }
+
+        bool discontinuous = false;
+        for (auto& pending : m_executingCommands)
+        {
+            pending.command(m_gameState);
+            discontinuous = discontinuous || pending.discontinuous;
+        }
+        m_executingCommands.clear();
+        return discontinuous;
+    }
+
+    void SimulationThread::Publish(bool discontinuous)
+    {
+        // 在锁外采集，持锁只交换索引（m_scratch 不会被借出或发布）
+        auto& snapshot = m_snapshots[m_scratch];
+        Systems::RenderSystem::CaptureSnapshot(m_gameState.GetRegistry(), snapshot);
+        snapshot.tick = m_tick;
+        snapshot.discontinuous = discontinuous;
+        snapshot.score = m_gameState.GetScore();
+        snapshot.moves = m_gameState.GetMoves();
+        snapshot.combo = m_gameState.GetCombo();
+
+        const uint64_t now = SDL_GetTicksNS();
+
+        std::lock_guard lock(m_snapshotMutex);
+        m_previous = m_latest;
+        m_latest = m_scratch;
+        m_latestPublishNS = now;
+
+        // 下一份填充到既未发布也未借出的缓冲
+        for (size_t i = 0; i < SNAPSHOT_BUFFERS; ++i)
+        {
+            if (i != m_previous && i != m_latest && i != m_readPrevious && i != m_readLatest)
+            {
+                m_scratch = i;
+                break;
+            }
+        }
+    }
+} // namespace Match3
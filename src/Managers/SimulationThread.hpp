@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Systems/RenderSnapshot.hpp"
+
+namespace Match3
+{
+    class GameStateManager;
+
+    /**
+     * @brief 模拟线程 - 在独立线程上以固定步长运行 GameStateManager
+     *
+     * 渲染线程与模拟线程之间只通过两条通道交互：
+     * - 命令队列：输入（点击、重置、存档）投递到模拟线程，在下一步开始时执行
+     * - 快照交换：模拟线程每步发布一份渲染快照，渲染线程借用最近两份并插值
+     *
+     * 快照放在固定的缓冲池里，持锁时只交换缓冲索引，不复制快照内容。
+     *
+     * 两边都只在交换数据时短暂持锁，任何一方卡顿都不会阻塞另一方。
+     * 启动后 GameStateManager 只能在模拟线程上访问。
+     */
+    class SimulationThread
+    {
+    public:
+        using Command = std::function<void(GameStateManager&)>;
+
+        SimulationThread(GameStateManager& gameState, float timestep);
+        ~SimulationThread();
+
+        SimulationThread(const SimulationThread&) = delete;
+        SimulationThread& operator=(const SimulationThread&) = delete;
+
+        /**
+         * @brief 启动模拟线程（会先发布一份初始快照）
+         */
+        void Start();
+
+        /**
+         * @brief 停止并等待模拟线程退出
+         */
+        void Stop();
+
+        [[nodiscard]] bool IsRunning() const { return m_running.load(std::memory_order_acquire); }
+
+        /**
+         * @brief 投递命令到模拟线程
+         * @param command 在模拟线程上执行的操作
+         * @param discontinuous 命令会让画面跳变（重置、读档），该步不做插值
+         */
+        void Post(Command command, bool discontinuous = false);
+
+        /**
+         * @brief 借用最近两份快照（只能在渲染线程调用）
+         *
+         * 借出的快照在下一次调用前保持不变，模拟线程不会写入它们。
+         * @param previous 输出：上一份快照
+         * @param current 输出：最新快照
+         * @return 插值系数 [0, 1]（距离最新快照发布的时间 / 步长）
+         */
+        float ReadSnapshots(const Systems::RenderSnapshot*& previous, const Systems::RenderSnapshot*& current);
+
+    private:
+        void Run();
+        bool ExecuteCommands();
+        void Publish(bool discontinuous);
+
+        GameStateManager& m_gameState;
+        const uint64_t m_timestepNS;
+        uint64_t m_tick = 0;
+
+        std::thread m_thread;
+        std::atomic<bool> m_running{false};
+
+        // 命令队列
+        struct PendingCommand
+        {
+            Command command;
+            bool discontinuous;
+        };
+
+        std::mutex m_commandMutex;
+        std::vector<PendingCommand> m_pendingCommands;
+        std::vector<PendingCommand> m_executingCommands;
+
+        // 快照缓冲池：已发布的两份 + 渲染线程借出的两份 + 模拟线程正在填充的一份
+        static constexpr size_t SNAPSHOT_BUFFERS = 5;
+
+        std::mutex m_snapshotMutex;
+        std::array<Systems::RenderSnapshot, SNAPSHOT_BUFFERS> m_snapshots;
+        size_t m_previous = 0;     // 已发布
+        size_t m_latest = 1;       // 已发布
+        size_t m_scratch = 2;      // 模拟线程在锁外填充，发布时成为 m_latest
+        size_t m_readPrevious = 0; // 渲染线程借出
+        size_t m_readLatest = 1;   // 渲染线程借出
+        uint64_t m_latestPublishNS = 0;
+    };
+} // namespace Match3
@@ -5,12 +5,22 @@ namespace Match3 {
 
 void SystemManager::UpdateAll(entt::registry& registry, float deltaTime)
 {
-    // 按顺序更新所有已启用的系统
-    for (auto& system : m_systems) {
+    // 按顺序更新所有已启用的系统，在同步点回放结构变更
+    size_t nextSync = 0;
+    for (size_t i = 0; i < m_systems.size(); ++i) {
+        while (nextSync < m_syncPoints.size() && m_syncPoints[nextSync] <= i) {
+            m_commands.Flush(registry);
+            ++nextSync;
+        }
+        
+        auto& system = m_systems[i];
         if (system && system->IsEnabled()) {
             system->Update(registry, deltaTime);
         }
     }
+    
+    // 帧末同步点
+    m_commands.Flush(registry);
 }
 
 void SystemManager::SetAllEnabled(bool enabled)
@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include "Systems/System.hpp"
+#include "Systems/CommandBuffer.hpp"
 
 namespace Match3 {
 
@@ -13,6 +14,7 @@ namespace Match3 {
  * 职责：
  * - 注册和管理所有系统
  * - 按固定顺序更新系统
+ * - 在同步点回放命令缓冲中的结构变更
  * - 提供系统查询接口
  */
 class SystemManager {
@@ -27,9 +29,17 @@ public:
     template<typename T>
     void AddSystem(std::shared_ptr<T> system) {
         static_assert(std::is_base_of_v<Systems::System, T>, "T must inherit from System");
+        system->SetCommandBuffer(&m_commands);
         m_systems.push_back(std::static_pointer_cast<Systems::System>(system));
     }
     
+    /**
+     * @brief 在最后添加的系统之后插入同步点
+     * UpdateAll 在同步点回放命令缓冲，之后的系统能看到之前系统的结构变更。
+     * UpdateAll 结束时总是回放一次。
+     */
+    void AddSyncPoint() { m_syncPoints.push_back(m_systems.size()); }
+    
     /**
      * @brief 添加系统但不参与UpdateAll（仅保持生命周期）
      * @tparam T 系统类型
@@ -38,6 +48,7 @@ public:
     template<typename T>
     void AddSystemNoUpdate(std::shared_ptr<T> system) {
         static_assert(std::is_base_of_v<Systems::System, T>, "T must inherit from System");
+        system->SetCommandBuffer(&m_commands);
         m_managedSystems.push_back(std::static_pointer_cast<Systems::System>(system));
     }
     
@@ -48,6 +59,17 @@ public:
      */
     void UpdateAll(entt::registry& registry, float deltaTime);
     
+    /**
+     * @brief 获取命令缓冲（系统外的逻辑也可以记录命令）
+     */
+    [[nodiscard]] Systems::CommandBuffer& GetCommandBuffer() { return m_commands; }
+    
+    /**
+     * @brief 在系统更新之外的同步点回放命令缓冲（例如事件派发之后）
+     * @return 执行的命令数量
+     */
+    size_t FlushCommands(entt::registry& registry) { return m_commands.Flush(registry); }
+    
     /**
      * @brief 获取系统
      * @tparam T 系统类型
@@ -79,11 +101,15 @@ public:
     void Clear() { 
         m_systems.clear(); 
         m_managedSystems.clear();
+        m_syncPoints.clear();
+        m_commands.Clear();
     }
     
 private:
+    Systems::CommandBuffer m_commands;                                  // 先于系统声明，最后析构
     std::vector<std::shared_ptr<Systems::System>> m_systems;           // 参与UpdateAll的系统
     std::vector<std::shared_ptr<Systems::System>> m_managedSystems;   // 仅管理生命周期的系统
+    std::vector<size_t> m_syncPoints;                                   // 在第i个系统之前回放命令
 };
 
 } // namespace Match3
@@ -0,0 +1,237 @@
+#include "BakedFont.hpp"
+#include <bit>
+#include <cstring>
+
+namespace Match3::BakedFontFormat
+{
+    namespace
+    {
+        class Writer
+        {
+        public:
+            explicit Writer(std::vector<uint8_t>& out) : m_out(out) {}
+
+            void U16(const uint16_t value)
+            {
+                m_out.push_back(static_cast<uint8_t>(value));
+                m_out.push_back(static_cast<uint8_t>(value >> 8));
+            }
+
+            void U32(const uint32_t value)
+            {
+                U16(static_cast<uint16_t>(value));
+                U16(static_cast<uint16_t>(value >> 16));
+            }
+
+            void Bytes(const void* data, const size_t size)
+            {
+                const auto* bytes = static_cast<const uint8_t*>(data);
+                m_out.insert(m_out.end(), bytes, bytes + size);
+            }
+
+        private:
+            std::vector<uint8_t>& m_out;
+        };
+
+        class Reader
+        {
+        public:
+            Reader(const uint8_t* data, const size_t size) : m_data(data), m_size(size) {}
+
+            bool U16(uint16_t& value)
+            {
+                if (!Has(2)) return false;
+                value = static_cast<uint16_t>(m_data[m_offset] | m_data[m_offset + 1] << 8);
+                m_offset += 2;
+                return true;
+            }
+
+            bool U32(uint32_t& value)
+            {
+                uint16_t low = 0, high = 0;
+                if (!U16(low) || !U16(high)) return false;
+                value = static_cast<uint32_t>(low) | static_cast<uint32_t>(high) << 16;
+                return true;
+            }
+
+            bool Bytes(void* out, const size_t size)
+            {
+                if (!Has(size)) return false;
+                std::memcpy(out, m_data + m_offset, size);
+                m_offset += size;
+                return true;
+            }
+
+            [[nodiscard]] bool Has(const size_t size) const { return m_size - m_offset >= size; }
+            [[nodiscard]] bool AtEnd() const { return m_offset == m_size; }
+
+        private:
+            const uint8_t* m_data;
+            size_t m_size;
+            size_t m_offset = 0;
+        };
+
+        bool ReadFont(Reader& reader, BakedFont& font, std::string& error)
+        {
+            uint16_t idLength = 0;
+            if (!reader.U16(idLength) || !reader.Has(idLength))
+            {
+                error = "truncated font id";
+                return false;
+            }
+            font.id.resize(idLength);
+            reader.Bytes(font.id.data(), idLength);
+
+            uint32_t sizeBits = 0, height = 0, glyphCount = 0, kerningCount = 0;
+            uint16_t pageWidth = 0, pageHeight = 0;
+            if (!reader.U32(sizeBits) || !reader.U32(height) || !reader.U16(pageWidth) || !reader.U16(pageHeight) ||
+                !reader.U32(glyphCount) || !reader.U32(kerningCount))
+            {
+                error = "truncated header of font '" + font.id + "'";
+                return false;
+            }
+
+            font.size = std::bit_cast<float>(sizeBits);
+            font.height = static_cast<int>(height);
+            font.pageWidth = pageWidth;
+            font.pageHeight = pageHeight;
+            if (pageWidth > MAX_PAGE_SIZE || pageHeight > MAX_PAGE_SIZE)
+            {
+                error = "page of font '" + font.id + "' exceeds the maximum size";
+                return false;
+            }
+
+            // 16 bytes per glyph and 10 per kerning pair: reject counts the file cannot hold
+            if (!reader.Has(static_cast<size_t>(glyphCount) * 16 + static_cast<size_t>(kerningCount) * 10))
+            {
+                error = "truncated glyph table of font '" + font.id + "'";
+                return false;
+            }
+
+            font.glyphs.resize(glyphCount);
+            for (auto& glyph : font.glyphs)
+            {
+                uint16_t offsetX = 0, advance = 0;
+                reader.U32(glyph.codepoint);
+                reader.U16(glyph.x);
+                reader.U16(glyph.y);
+                reader.U16(glyph.width);
+                reader.U16(glyph.height);
+                reader.U16(offsetX);
+                reader.U16(advance);
+                glyph.offsetX = static_cast<int16_t>(offsetX);
+                glyph.advance = static_cast<int16_t>(advance);
+
+                if (glyph.x + glyph.width > pageWidth || glyph.y + glyph.height > pageHeight)
+                {
+                    error = "glyph cell outside the page of font '" + font.id + "'";
+                    return false;
+                }
+            }
+
+            font.kerning.resize(kerningCount);
+            for (auto& pair : font.kerning)
+            {
+                uint16_t amount = 0;
+                reader.U32(pair.first);
+                reader.U32(pair.second);
+                reader.U16(amount);
+                pair.amount = static_cast<int16_t>(amount);
+            }
+
+            font.coverage.resize(static_cast<size_t>(pageWidth) * pageHeight);
+            if (!reader.Bytes(font.coverage.data(), font.coverage.size()))
+            {
+                error = "truncated coverage page of font '" + font.id + "'";
+                return false;
+            }
+            return true;
+        }
+    }
+
+    std::vector<uint8_t> Write(const std::vector<BakedFont>& fonts)
+    {
+        std::vector<uint8_t> out;
+        Writer writer(out);
+
+        writer.Bytes(MAGIC, sizeof(MAGIC));
+        writer.U32(VERSION);
+        writer.U32(static_cast<uint32_t>(fonts.size()));
+
+        for (const auto& font : fonts)
+        {
+            writer.U16(static_cast<uint16_t>(font.id.size()));
+            writer.Bytes(font.id.data(), font.id.size());
+            writer.U32(std::bit_cast<uint32_t>(font.size));
+            writer.U32(static_cast<uint32_t>(font.height));
+            writer.U16(static_cast<uint16_t>(font.pageWidth));
+            writer.U16(static_cast<uint16_t>(font.pageHeight));
+            writer.U32(static_cast<uint32_t>(font.glyphs.size()));
+            writer.U32(static_cast<uint32_t>(font.kerning.size()));
+
+            for (const auto& glyph : font.glyphs)
+            {
+                writer.U32(glyph.codepoint);
+                writer.U16(glyph.x);
+                writer.U16(glyph.y);
+                writer.U16(glyph.width);
+                writer.U16(glyph.height);
+                writer.U16(static_cast<uint16_t>(glyph.offsetX));
+                writer.U16(static_cast<uint16_t>(glyph.advance));
+            }
+
+            for (const auto& pair : font.kerning)
+            {
+                writer.U32(pair.first);
+                writer.U32(pair.second);
+                writer.U16(static_cast<uint16_t>(pair.amount));
+            }
+
+            writer.Bytes(font.coverage.data(), font.coverage.size());
+        }
+        return out;
+    }
+
+    bool Read(const uint8_t* data, const size_t size, std::vector<BakedFont>& fonts, std::string& error)
+    {
+        fonts.clear();
+        Reader reader(data, size);
+
+        char magic[sizeof(MAGIC)] = {};
+        uint32_t version = 0, fontCount = 0;
+        if (!reader.Bytes(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+        {
+            error = "not a baked font file";
+            return false;
+        }
+        if (!reader.U32(version) || version != VERSION)
+        {
+            error = "unsupported baked font version " + std::to_string(version);
+            return false;
+        }
+        // Every font header takes at least 26 bytes
+        if (!reader.U32(fontCount) || !reader.Has(static_cast<size_t>(fontCount) * 26))
+        {
+            error = "truncated header";
+            return false;
+        }
+
+        fonts.resize(fontCount);
+        for (auto& font : fonts)
+        {
+            if (!ReadFont(reader, font, error))
+            {
+                fonts.clear();
+                return false;
+            }
+        }
+
+        if (!reader.AtEnd())
+        {
+            error = "trailing data after the last font";
+            fonts.clear();
+            return false;
+        }
+        return true;
+    }
+} // namespace Match3::BakedFontFormat
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Match3
+{
+    /**
+     * @brief A glyph cell inside a baked coverage page
+     *
+     * Same layout as a runtime Glyph: the cell spans the full font height and is
+     * placed at (pen + offsetX, line top). Blank glyphs have a zero-sized cell.
+     */
+    struct BakedGlyph
+    {
+        uint32_t codepoint = 0;
+        uint16_t x = 0;
+        uint16_t y = 0;
+        uint16_t width = 0;
+        uint16_t height = 0;
+        int16_t offsetX = 0;
+        int16_t advance = 0;
+    };
+
+    /**
+     * @brief Non-zero kerning between two baked codepoints
+     */
+    struct BakedKerning
+    {
+        uint32_t first = 0;
+        uint32_t second = 0;
+        int16_t amount = 0;
+    };
+
+    /**
+     * @brief One font size baked into a single 8-bit coverage page
+     */
+    struct BakedFont
+    {
+        std::string id;
+        float size = 0.0f;
+        int height = 0;
+        int pageWidth = 0;
+        int pageHeight = 0;
+        std::vector<BakedGlyph> glyphs;     // Sorted by codepoint
+        std::vector<BakedKerning> kerning;  // Pairs not listed have zero kerning
+        std::vector<uint8_t> coverage;      // pageWidth * pageHeight alpha values
+    };
+
+    /**
+     * @brief Binary container for pre-baked UI fonts (*.m3font)
+     *
+     * Written at build time by tools/FontBaker and read at startup with a
+     * single file read. All values are little-endian:
+     *
+     *   "M3BF" u32 version u32 fontCount
+     *   per font: u16 idLength, id, f32 size, i32 height, u16 pageWidth, u16 pageHeight,
+     *             u32 glyphCount, u32 kerningCount,
+     *             glyphs  (u32 codepoint, u16 x, y, w, h, i16 offsetX, i16 advance),
+     *             kerning (u32 first, u32 second, i16 amount),
+     *             coverage (pageWidth * pageHeight bytes)
+     */
+    namespace BakedFontFormat
+    {
+        inline constexpr char MAGIC[4] = {'M', '3', 'B', 'F'};
+        inline constexpr uint32_t VERSION = 1;
+        inline constexpr int MAX_PAGE_SIZE = 1024; // Matches GlyphAtlas::PAGE_SIZE
+
+        /**
+         * @brief Serialise fonts into the container format
+         */
+        std::vector<uint8_t> Write(const std::vector<BakedFont>& fonts);
+
+        /**
+         * @brief Parse a container
+         * @param data File contents
+         * @param size Number of bytes
+         * @param fonts Output fonts
+         * @param error Reason on failure
+         * @return true if the whole file was valid
+         */
+        bool Read(const uint8_t* data, size_t size, std::vector<BakedFont>& fonts, std::string& error);
+    }
+} // namespace Match3
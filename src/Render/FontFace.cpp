@@ -0,0 +1,58 @@
+#include "FontFace.hpp"
+#include "Core/Logger.hpp"
+
+namespace Match3
+{
+    std::unique_ptr<FontFace> FontFace::Open(std::string source, std::shared_ptr<const std::vector<uint8_t>> data,
+                                             const float size)
+    {
+        if (!data || data->empty())
+        {
+            LOG_ERROR("No font data for '{}'", source);
+            return nullptr;
+        }
+
+        // SDL_ttf reads the face lazily, so the buffer must outlive the font
+        SDL_IOStream* io = SDL_IOFromConstMem(data->data(), data->size());
+        TTF_Font* font = io ? TTF_OpenFontIO(io, true, size) : nullptr;
+        if (!font)
+        {
+            LOG_ERROR("Failed to open font face '{}': {}", source, SDL_GetError());
+            return nullptr;
+        }
+
+        return std::unique_ptr<FontFace>(new FontFace(std::move(source), std::move(data), font, size));
+    }
+
+    FontFace::FontFace(std::string source, std::shared_ptr<const std::vector<uint8_t>> data, TTF_Font* font,
+                       const float size)
+        : m_source(std::move(source))
+          , m_data(std::move(data))
+          , m_font(font)
+          , m_size(size)
+    {
+    }
+
+    FontFace::~FontFace()
+    {
+        TTF_CloseFont(m_font);
+        LOG_DEBUG("Closed font face '{}' ({} size switches)", m_source, m_sizeSwitches);
+    }
+
+    TTF_Font* FontFace::Bind(const float size)
+    {
+        if (size != m_size)
+        {
+            if (TTF_SetFontSize(m_font, size))
+            {
+                m_size = size;
+                ++m_sizeSwitches;
+            }
+            else
+            {
+                LOG_WARN("Failed to set size {} on font face '{}': {}", size, m_source, SDL_GetError());
+            }
+        }
+        return m_font;
+    }
+} // namespace Match3
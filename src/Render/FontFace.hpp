@@ -0,0 +1,59 @@
+#pragma once
+
+#include <SDL3_ttf/SDL_ttf.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Match3
+{
+    /**
+     * @brief One font file, read and parsed once, shared by every size loaded from it
+     *
+     * Size variants are derived by switching the point size with TTF_SetFontSize()
+     * right before metrics or rasterisation. Each size keeps its own lazily
+     * filled GlyphAtlas, so switches only happen on glyph cache misses.
+     */
+    class FontFace
+    {
+    public:
+        /**
+         * @brief Open a face from file contents
+         * @param source Path or other identifier, used as the sharing key
+         * @param data File contents; must stay alive while the face is open
+         * @param size Initial point size
+         * @return Face, or nullptr on failure
+         */
+        static std::unique_ptr<FontFace> Open(std::string source, std::shared_ptr<const std::vector<uint8_t>> data,
+                                              float size);
+
+        ~FontFace();
+
+        // Disable copy
+        FontFace(const FontFace&) = delete;
+        FontFace& operator=(const FontFace&) = delete;
+
+        /**
+         * @brief Switch to a point size (if needed) and return the underlying font
+         */
+        TTF_Font* Bind(float size);
+
+        [[nodiscard]] const std::string& GetSource() const { return m_source; }
+        [[nodiscard]] size_t GetDataSize() const { return m_data ? m_data->size() : 0; }
+
+        /**
+         * @brief Number of point-size switches so far (cache-miss indicator)
+         */
+        [[nodiscard]] uint64_t GetSizeSwitchCount() const { return m_sizeSwitches; }
+
+    private:
+        FontFace(std::string source, std::shared_ptr<const std::vector<uint8_t>> data, TTF_Font* font, float size);
+
+        std::string m_source;
+        std::shared_ptr<const std::vector<uint8_t>> m_data;
+        TTF_Font* m_font;
+        float m_size;
+        uint64_t m_sizeSwitches = 0;
+    };
+} // namespace Match3
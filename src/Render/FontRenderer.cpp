@@ -1,5 +1,8 @@
 #include "FontRenderer.hpp"
+#include "BakedFont.hpp"
 #include "Core/Logger.hpp"
+#include <algorithm>
+#include <cmath>
 
 namespace Match3
 {
@@ -42,70 +45,216 @@ namespace Match3
         }
 
         // Check if font already loaded
-        if (m_fonts.find(fontId) != m_fonts.end())
+        if (HasFont(fontId))
         {
             LOG_WARN("Font '{}' already loaded", fontId);
             return true;
         }
 
-        TTF_Font* font = TTF_OpenFont(fontPath.c_str(), size);
-        if (!font)
+        // Another size of this file may already be open: OpenFace() shares it
+        FontFace* face = OpenFace(fontPath, static_cast<float>(size));
+        if (!face)
         {
-            LOG_ERROR("Failed to load font '{}' from {}: {}", fontId, fontPath, SDL_GetError());
+            LOG_ERROR("Failed to load font '{}' from {}", fontId, fontPath);
             return false;
         }
 
-        m_fonts[fontId] = font;
-        LOG_INFO("Loaded font '{}' (size: {}) from {}", fontId, size, fontPath);
-        return true;
+        return AddFont(*face, size, fontId);
     }
 
-    void FontRenderer::RenderText(const std::string& text, int x, int y, const std::string& fontId,
-                                  uint8_t r, uint8_t g, uint8_t b, uint8_t a,
-                                  TextAlign align)
+    FontFace* FontRenderer::OpenFace(const std::string& source, const float size)
     {
-        if (text.empty())
-            return;
+        if (const auto it = m_faces.find(source); it != m_faces.end())
+        {
+            return it->second.get();
+        }
+
+        size_t fileSize = 0;
+        void* raw = SDL_LoadFile(source.c_str(), &fileSize);
+        if (!raw)
+        {
+            LOG_ERROR("Failed to read font file {}: {}", source, SDL_GetError());
+            return nullptr;
+        }
+        const auto* bytes = static_cast<const uint8_t*>(raw);
+        auto data = std::make_shared<const std::vector<uint8_t>>(bytes, bytes + fileSize);
+        SDL_free(raw);
+
+        auto face = FontFace::Open(source, std::move(data), size);
+        if (!face)
+        {
+            return nullptr;
+        }
+        LOG_INFO("Opened font face {} ({} KB)", source, face->GetDataSize() / 1024);
+        return m_faces.emplace(source, std::move(face)).first->second.get();
+    }
+
+    bool FontRenderer::LoadFontFromMemory(const std::string& source, std::shared_ptr<const std::vector<uint8_t>> data,
+                                          int size, const std::string& fontId)
+    {
+        if (!m_initialized)
+        {
+            LOG_ERROR("FontRenderer not initialized. Call Initialize() first");
+            return false;
+        }
+
+        if (HasFont(fontId))
+        {
+            LOG_WARN("Font '{}' already loaded", fontId);
+            return true;
+        }
 
-        auto it = m_fonts.find(fontId);
-        if (it == m_fonts.end())
+        auto it = m_faces.find(source);
+        if (it == m_faces.end())
+        {
+            auto face = FontFace::Open(source, std::move(data), static_cast<float>(size));
+            if (!face)
+            {
+                LOG_ERROR("Failed to load font '{}' from {}", fontId, source);
+                return false;
+            }
+            LOG_INFO("Opened font face {} ({} KB)", source, face->GetDataSize() / 1024);
+            it = m_faces.emplace(source, std::move(face)).first;
+        }
+
+        return AddFont(*it->second, size, fontId);
+    }
+
+    FontRenderer::FontEntry& FontRenderer::AddEntry(const std::string& fontId)
+    {
+        m_fontIds.emplace(fontId, FontHandle{static_cast<uint32_t>(m_fonts.size())});
+        FontEntry& entry = m_fonts.emplace_back();
+        entry.id = fontId;
+        return entry;
+    }
+
+    FontRenderer::FontEntry* FontRenderer::GetEntry(const FontHandle font)
+    {
+        if (font.index < m_fonts.size())
+        {
+            return &m_fonts[font.index];
+        }
+        if (font.IsValid())
+        {
+            LOG_ERROR("Stale font handle {}", font.index);
+        }
+        return nullptr;
+    }
+
+    FontHandle FontRenderer::FindFont(const std::string& fontId) const
+    {
+        const auto it = m_fontIds.find(fontId);
+        return it != m_fontIds.end() ? it->second : FontHandle{};
+    }
+
+    FontHandle FontRenderer::Resolve(const std::string& fontId) const
+    {
+        const FontHandle font = FindFont(fontId);
+        if (!font.IsValid())
         {
             LOG_ERROR("Font '{}' not found. Load it first with LoadFont()", fontId);
-            return;
         }
+        return font;
+    }
 
-        TTF_Font* font = it->second;
+    bool FontRenderer::AddFont(FontFace& face, const int size, const std::string& fontId)
+    {
+        FontEntry& entry = AddEntry(fontId);
+        entry.size = static_cast<float>(size);
+        entry.height = TTF_GetFontHeight(face.Bind(entry.size));
+        entry.atlas = std::make_unique<GlyphAtlas>(m_sdlRenderer, [&face] { return &face; }, entry.size);
+        LOG_INFO("Loaded font '{}' (size: {}) from {}", fontId, size, face.GetSource());
+        return true;
+    }
 
-        // Create surface from text
-        SDL_Color color = {r, g, b, a};
-        SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), text.length(), color);
-        if (!surface)
+    bool FontRenderer::LoadBakedFonts(const std::string& fallbackSource,
+                                      const std::shared_ptr<const std::vector<uint8_t>>& data)
+    {
+        if (!m_initialized)
         {
-            LOG_ERROR("Failed to render text: {}", SDL_GetError());
-            return;
+            LOG_ERROR("FontRenderer not initialized. Call Initialize() first");
+            return false;
         }
 
-        // Create texture from surface
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(m_sdlRenderer, surface);
-        if (!texture)
+        if (!data)
         {
-            LOG_ERROR("Failed to create texture from text: {}", SDL_GetError());
-            SDL_DestroySurface(surface);
-            return;
+            LOG_ERROR("No baked font data");
+            return false;
         }
 
-        // Calculate position based on alignment
-        int textWidth = surface->w;
-        int textHeight = surface->h;
+        std::vector<BakedFont> fonts;
+        std::string error;
+        if (!BakedFontFormat::Read(data->data(), data->size(), fonts, error))
+        {
+            LOG_ERROR("Invalid baked font file: {}", error);
+            return false;
+        }
+
+        bool succeeded = true;
+        for (auto& font : fonts)
+        {
+            if (HasFont(font.id))
+            {
+                LOG_WARN("Font '{}' already loaded", font.id);
+                continue;
+            }
+
+            const float size = font.size;
+            auto atlas = std::make_unique<GlyphAtlas>(
+                m_sdlRenderer,
+                [this, fallbackSource, size]
+                {
+                    LOG_INFO("Glyph outside the baked subset, opening {}", fallbackSource);
+                    return OpenFace(fallbackSource, size);
+                },
+                size);
+
+            const std::string fontId = font.id;
+            const size_t glyphCount = font.glyphs.size();
+            const int height = font.height;
+            if (!atlas->AddBaked(std::make_shared<const BakedFont>(std::move(font))))
+            {
+                succeeded = false;
+                continue;
+            }
+            FontEntry& entry = AddEntry(fontId);
+            entry.size = size;
+            entry.height = height;
+            entry.atlas = std::move(atlas);
+            LOG_INFO("Loaded baked font '{}' (size: {}, {} glyphs)", fontId, size, glyphCount);
+        }
+        return succeeded;
+    }
+
+    void FontRenderer::RenderText(const std::string& text, int x, int y, const std::string& fontId,
+                                  uint8_t r, uint8_t g, uint8_t b, uint8_t a,
+                                  TextAlign align)
+    {
+        RenderText(text, x, y, Resolve(fontId), r, g, b, a, align);
+    }
 
+    void FontRenderer::RenderText(const std::string& text, int x, int y, const FontHandle font,
+                                  uint8_t r, uint8_t g, uint8_t b, uint8_t a,
+                                  TextAlign align)
+    {
+        if (text.empty())
+            return;
+
+        const TextRun* run = GetRun(text, font);
+        if (!run)
+            return;
+
+        ++m_stats.textDraws;
+
+        // Calculate position based on alignment
         int renderX = x;
         switch (align)
         {
         case TextAlign::Center:
-            renderX = x - textWidth / 2;
+            renderX = x - run->width / 2;
             break;
         case TextAlign::Right:
-            renderX = x - textWidth;
+            renderX = x - run->width;
             break;
         case TextAlign::Left:
         default:
@@ -113,71 +262,327 @@ namespace Match3
             break;
         }
 
-        // Render texture
-        SDL_FRect destRect = {
-            static_cast<float>(renderX),
-            static_cast<float>(y),
-            static_cast<float>(textWidth),
-            static_cast<float>(textHeight)
-        };
+        const SDL_FColor color = {r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f};
+        const auto offsetX = static_cast<float>(renderX);
+        const auto offsetY = static_cast<float>(y);
 
-        SDL_RenderTexture(m_sdlRenderer, texture, nullptr, &destRect);
+        // Translate and tint the cached quads, one geometry call per atlas page
+        for (const auto& page : run->pages)
+        {
+            m_vertexScratch.assign(run->vertices.begin() + page.firstVertex,
+                                   run->vertices.begin() + page.firstVertex + page.vertexCount);
+            for (auto& vertex : m_vertexScratch)
+            {
+                vertex.position.x += offsetX;
+                vertex.position.y += offsetY;
+                vertex.color = color;
+            }
 
-        // Cleanup
-        SDL_DestroyTexture(texture);
-        SDL_DestroySurface(surface);
+            SDL_RenderGeometry(m_sdlRenderer, page.texture,
+                               m_vertexScratch.data(), page.vertexCount,
+                               run->indices.data() + page.firstIndex, page.indexCount);
+            ++m_stats.drawCalls;
+            m_stats.vertices += page.vertexCount;
+        }
     }
 
     int FontRenderer::MeasureText(const std::string& text, const std::string& fontId)
+    {
+        return MeasureText(text, Resolve(fontId));
+    }
+
+    int FontRenderer::MeasureText(const std::string& text, const FontHandle font)
     {
         if (text.empty())
             return 0;
 
-        auto it = m_fonts.find(fontId);
-        if (it == m_fonts.end())
-        {
-            LOG_ERROR("Font '{}' not found", fontId);
+        const TextRun* run = GetRun(text, font);
+        if (!run)
             return -1;
+
+        return run->width;
+    }
+
+    int FontRenderer::GetTextHeight(const std::string& fontId)
+    {
+        return GetTextHeight(Resolve(fontId));
+    }
+
+    int FontRenderer::GetTextHeight(const FontHandle font)
+    {
+        const FontEntry* entry = GetEntry(font);
+        return entry ? entry->height : -1;
+    }
+
+    bool FontRenderer::CreateTextTexture(const std::string& text, const std::string& fontId, Texture& texture)
+    {
+        return CreateTextTexture(text, Resolve(fontId), texture);
+    }
+
+    bool FontRenderer::CreateTextTexture(const std::string& text, const FontHandle font, Texture& texture)
+    {
+        texture.Free();
+        if (text.empty())
+            return false;
+
+        FontEntry* entry = GetEntry(font);
+        if (!entry)
+            return false;
+
+        // Baked text is composed from resident coverage; anything else goes through the face
+        SDL_Surface* surface = entry->atlas->RenderBaked(text, entry->height);
+        if (!surface)
+        {
+            FontFace* face = entry->atlas->GetFace();
+            if (!face)
+            {
+                LOG_ERROR("Font '{}' has no face to render '{}'", entry->id, text);
+                return false;
+            }
+            surface = TTF_RenderText_Blended(face->Bind(entry->size), text.c_str(), text.length(),
+                                             SDL_Color{255, 255, 255, 255});
+        }
+        if (!surface)
+        {
+            LOG_ERROR("Failed to render text: {}", SDL_GetError());
+            return false;
         }
 
-        int width = 0;
-        int height = 0;
-        if (!TTF_GetStringSize(it->second, text.c_str(), text.length(), &width, &height))
+        ++m_stats.textRasterisations;
+        const bool created = texture.CreateFromSurface(m_sdlRenderer, surface);
+        SDL_DestroySurface(surface);
+        return created;
+    }
+
+    bool FontRenderer::GetDigitGlyphs(const std::string& fontId, DigitGlyphs& digits)
+    {
+        return GetDigitGlyphs(Resolve(fontId), digits);
+    }
+
+    bool FontRenderer::GetDigitGlyphs(const FontHandle font, DigitGlyphs& digits)
+    {
+        FontEntry* entry = GetEntry(font);
+        if (!entry)
+            return false;
+
+        digits = {};
+        for (int digit = 0; digit < 10; ++digit)
         {
-            LOG_ERROR("Failed to measure text: {}", SDL_GetError());
-            return -1;
+            const Glyph* glyph = entry->atlas->GetGlyph(static_cast<uint32_t>('0' + digit));
+            if (!glyph)
+            {
+                LOG_ERROR("Font '{}' has no glyph for digit {}", entry->id, digit);
+                return false;
+            }
+            digits.digits[digit] = *glyph;
+            digits.advance = std::max(digits.advance, static_cast<int>(std::ceil(glyph->advance)));
         }
 
-        return width;
+        if (const Glyph* minus = entry->atlas->GetGlyph('-'))
+        {
+            digits.minus = *minus;
+        }
+        digits.height = entry->height;
+        return true;
     }
 
-    int FontRenderer::GetTextHeight(const std::string& fontId)
+    void FontRenderer::ClearCaches()
     {
-        auto it = m_fonts.find(fontId);
-        if (it == m_fonts.end())
+        m_runs.clear();
+        m_runIndex.clear();
+        for (auto& entry : m_fonts)
         {
-            LOG_ERROR("Font '{}' not found", fontId);
-            return -1;
+            if (entry.atlas)
+            {
+                entry.atlas->Clear();
+            }
         }
+    }
 
-        return TTF_GetFontHeight(it->second);
+    FontRenderer::MemoryStats FontRenderer::GetMemoryStats() const
+    {
+        MemoryStats stats;
+        stats.faces = m_faces.size();
+        stats.sizes = m_fonts.size();
+        for (const auto& [source, face] : m_faces)
+        {
+            stats.fontDataBytes += face->GetDataSize();
+        }
+        for (const auto& entry : m_fonts)
+        {
+            stats.atlasPages += entry.atlas->GetPageCount();
+            stats.atlasBytes += entry.atlas->GetPageBytes();
+            stats.glyphs += entry.atlas->GetGlyphCount();
+            stats.bakedGlyphs += entry.atlas->GetBakedGlyphCount();
+            stats.bakedBytes += entry.atlas->GetBakedBytes();
+        }
+        stats.cachedRuns = m_runs.size();
+        for (const auto& cached : m_runs)
+        {
+            stats.runBytes += cached.key.capacity() +
+                cached.run.vertices.capacity() * sizeof(SDL_Vertex) +
+                cached.run.indices.capacity() * sizeof(int) +
+                cached.run.pages.capacity() * sizeof(TextRun::PageRange);
+        }
+        return stats;
     }
 
-    void FontRenderer::Shutdown()
+    void FontRenderer::LogMemoryStats() const
     {
-        if (!m_initialized)
-            return;
+        const MemoryStats stats = GetMemoryStats();
+        LOG_INFO("Font memory: {} face(s) / {} size(s), {} KB font data, {} atlas page(s) ({} KB, {} glyphs), "
+                 "{} baked glyph(s) ({} KB), {} cached run(s) ({} KB)",
+                 stats.faces, stats.sizes, stats.fontDataBytes / 1024, stats.atlasPages, stats.atlasBytes / 1024,
+                 stats.glyphs, stats.bakedGlyphs, stats.bakedBytes / 1024, stats.cachedRuns, stats.runBytes / 1024);
+    }
+
+    void FontRenderer::EndFrame()
+    {
+        m_lastFrameStats = m_stats;
+        m_stats = {};
+    }
+
+    const FontRenderer::TextRun* FontRenderer::GetRun(const std::string& text, const FontHandle font)
+    {
+        // Key: fixed-size font index followed by the text (reused buffer, no allocation once warm)
+        m_keyScratch.assign(reinterpret_cast<const char*>(&font.index), sizeof(font.index));
+        m_keyScratch.append(text);
+
+        if (const auto it = m_runIndex.find(m_keyScratch); it != m_runIndex.end())
+        {
+            m_runs.splice(m_runs.begin(), m_runs, it->second);
+            return &it->second->run;
+        }
+
+        FontEntry* entry = GetEntry(font);
+        if (!entry)
+            return nullptr;
+
+        // Evict the least recently used run
+        if (m_runs.size() >= MAX_CACHED_RUNS)
+        {
+            m_runIndex.erase(m_runs.back().key);
+            m_runs.pop_back();
+        }
+
+        const size_t glyphCount = entry->atlas->GetGlyphCount();
+        m_runs.push_front(CachedRun{m_keyScratch, {}});
+        LayoutRun(*entry, text, m_runs.front().run);
+        ++m_stats.runLayouts;
+        m_stats.glyphsRasterised += static_cast<int>(entry->atlas->GetGlyphCount() - glyphCount);
+        m_runIndex.emplace(m_runs.front().key, m_runs.begin());
+        return &m_runs.front().run;
+    }
+
+    void FontRenderer::LayoutRun(FontEntry& entry, const std::string& text, TextRun& run)
+    {
+        // Glyphs are copied: rasterising a later one may move earlier records
+        struct Quad
+        {
+            Glyph glyph;
+            float x;
+        };
+
+        std::vector<Quad> quads;
+        quads.reserve(text.size());
+
+        float pen = 0.0f;
+        float right = 0.0f;
+        uint32_t previous = 0;
+
+        const char* cursor = text.c_str();
+        size_t remaining = text.size();
+        while (remaining > 0)
+        {
+            const uint32_t codepoint = SDL_StepUTF8(&cursor, &remaining);
+            if (codepoint == 0)
+                break;
+
+            const Glyph* glyph = entry.atlas->GetGlyph(codepoint);
+            if (!glyph)
+                continue;
 
-        // Free all fonts
-        for (auto& [fontId, font] : m_fonts)
+            if (previous != 0)
+            {
+                pen += static_cast<float>(entry.atlas->GetKerning(previous, codepoint));
+            }
+
+            if (glyph->page)
+            {
+                const float x = pen + glyph->offsetX;
+                quads.push_back({*glyph, x});
+                right = std::max(right, x + glyph->source.w);
+            }
+
+            pen += glyph->advance;
+            previous = codepoint;
+        }
+
+        run.width = static_cast<int>(std::ceil(std::max(pen, right)));
+        run.height = entry.height;
+
+        // Group quads by atlas page (pages in order of first use)
+        std::vector<Texture*> pages;
+        for (const auto& quad : quads)
+        {
+            if (std::find(pages.begin(), pages.end(), quad.glyph.page) == pages.end())
+            {
+                pages.push_back(quad.glyph.page);
+            }
+        }
+
+        for (Texture* page : pages)
         {
-            if (font)
+            TextRun::PageRange range{
+                page->GetSDLTexture(),
+                static_cast<int>(run.vertices.size()), 0,
+                static_cast<int>(run.indices.size()), 0
+            };
+
+            // Baked pages are trimmed to their content, so sizes differ per page
+            const float invWidth = 1.0f / static_cast<float>(page->GetWidth());
+            const float invHeight = 1.0f / static_cast<float>(page->GetHeight());
+            for (const auto& quad : quads)
             {
-                TTF_CloseFont(font);
-                LOG_DEBUG("Closed font '{}'", fontId);
+                if (quad.glyph.page != page)
+                    continue;
+
+                const SDL_FRect& src = quad.glyph.source;
+                const float u0 = src.x * invWidth;
+                const float v0 = src.y * invHeight;
+                const float u1 = (src.x + src.w) * invWidth;
+                const float v1 = (src.y + src.h) * invHeight;
+                const float x0 = quad.x;
+                const float x1 = quad.x + src.w;
+                const float y1 = src.h;
+
+                const int base = range.vertexCount;
+                const SDL_FColor white = {1.0f, 1.0f, 1.0f, 1.0f};
+                run.vertices.push_back({{x0, 0.0f}, white, {u0, v0}});
+                run.vertices.push_back({{x1, 0.0f}, white, {u1, v0}});
+                run.vertices.push_back({{x1, y1}, white, {u1, v1}});
+                run.vertices.push_back({{x0, y1}, white, {u0, v1}});
+                run.indices.insert(run.indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+                range.vertexCount += 4;
+                range.indexCount += 6;
             }
+
+            run.pages.push_back(range);
         }
+    }
+
+    void FontRenderer::Shutdown()
+    {
+        if (!m_initialized)
+            return;
+
+        LogMemoryStats();
+
+        // Atlases reference the faces, drop them first
+        ClearCaches();
         m_fonts.clear();
+        m_fontIds.clear();
+        m_faces.clear();
 
         TTF_Quit();
         m_initialized = false;
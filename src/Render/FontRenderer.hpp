@@ -2,12 +2,23 @@
 
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
+#include "FontFace.hpp"
+#include "GlyphAtlas.hpp"
+#include "Utils/Handle.hpp"
+#include <ankerl/unordered_dense.h>
+#include <array>
+#include <list>
 #include <string>
-#include <unordered_map>
 #include <memory>
+#include <vector>
 
 namespace Match3
 {
+    /**
+     * @brief Loaded font size, resolved once from its id with FontRenderer::FindFont()
+     */
+    using FontHandle = Handle<struct FontTag>;
+
     /**
      * @brief Text alignment options
      */
@@ -20,6 +31,23 @@ namespace Match3
 
     /**
      * @brief Font renderer using SDL_ttf for bitmap font rendering
+     *
+     * Glyphs are rasterised once into a per-font GlyphAtlas. Each distinct
+     * (font, string) pair is laid out once into a TextRun of textured quads and
+     * kept in an LRU cache, so steady-state frames make no TTF calls and create
+     * no textures: drawing a cached run is one SDL_RenderGeometry per atlas page.
+     *
+     * Each font file is read and parsed once into a FontFace; every size loaded
+     * from the same file shares it and only adds its own glyph atlas.
+     *
+     * Fonts can also come from a pre-baked subset (see BakedFont): its atlas
+     * pages are uploaded directly and the TTF is only read and parsed the first
+     * time dynamic text needs a glyph outside the subset.
+     *
+     * Fonts live in a dense array: callers resolve an id to a FontHandle once
+     * (e.g. when a component gets its font) and draw with the handle, so the
+     * per-frame path indexes instead of hashing the id. The string overloads
+     * resolve on every call and are meant for tools and one-off text.
      */
     class FontRenderer
     {
@@ -37,8 +65,41 @@ namespace Match3
          */
         bool Initialize();
 
+        /**
+         * @brief Font subsystem memory usage
+         */
+        struct MemoryStats
+        {
+            size_t faces = 0;         // Distinct font files held open
+            size_t sizes = 0;         // Loaded font ids (face + size)
+            size_t fontDataBytes = 0; // Font file bytes kept resident
+            size_t atlasPages = 0;
+            size_t atlasBytes = 0;    // Estimated texture memory of atlas pages
+            size_t glyphs = 0;
+            size_t bakedGlyphs = 0;   // Glyphs served from baked pages
+            size_t bakedBytes = 0;    // Baked coverage kept for CreateTextTexture()
+            size_t cachedRuns = 0;
+            size_t runBytes = 0;      // Vertex/index data of cached text runs
+        };
+
+        /**
+         * @brief Per-frame text work, saved by EndFrame()
+         */
+        struct FrameStats
+        {
+            int textDraws = 0;          // RenderText() calls
+            int drawCalls = 0;          // SDL_RenderGeometry calls (one per atlas page of a run)
+            int vertices = 0;
+            int runLayouts = 0;         // Run cache misses: text shaped and laid out
+            int glyphsRasterised = 0;   // Glyphs added to an atlas while laying out
+            int textRasterisations = 0; // CreateTextTexture(): whole strings rendered to a texture
+        };
+
         /**
          * @brief Load a font from file
+         *
+         * The file is only read and parsed the first time a path is seen;
+         * further sizes share the same face.
          * @param fontPath Path to the TTF font file
          * @param size Font size in points
          * @param fontId Unique identifier for this font
@@ -46,18 +107,54 @@ namespace Match3
          */
         bool LoadFont(const std::string& fontPath, int size, const std::string& fontId);
 
+        /**
+         * @brief Load a font from an in-memory TTF file (e.g. read by AssetLoader)
+         * @param source Path or identifier of the data; sizes with the same source share one face
+         * @param data File contents; kept alive for as long as the face is open
+         * @param size Font size in points
+         * @param fontId Unique identifier for this font
+         * @return true if successful
+         */
+        bool LoadFontFromMemory(const std::string& source, std::shared_ptr<const std::vector<uint8_t>> data,
+                                int size, const std::string& fontId);
+
+        /**
+         * @brief Load every font of a baked font file (see BakedFont)
+         *
+         * Fonts keep their baked ids. Glyphs outside the baked subset are
+         * rasterised from fallbackSource, which is only read on first need.
+         * @param fallbackSource Path of the TTF the file was baked from
+         * @param data Baked file contents; not retained
+         * @return true if the file was valid and all fonts were uploaded
+         */
+        bool LoadBakedFonts(const std::string& fallbackSource, const std::shared_ptr<const std::vector<uint8_t>>& data);
+
+        /**
+         * @brief Whether a font id has been loaded
+         */
+        [[nodiscard]] bool HasFont(const std::string& fontId) const { return m_fontIds.contains(fontId); }
+
+        /**
+         * @brief Resolve a font id to a handle
+         * @return Invalid handle if the font is not loaded; handles stay valid until Shutdown()
+         */
+        [[nodiscard]] FontHandle FindFont(const std::string& fontId) const;
+
         /**
          * @brief Render text to screen
          * @param text Text to render
          * @param x X position
          * @param y Y position
-         * @param fontId Font identifier
+         * @param font Font handle (or id, resolved per call)
          * @param r Red component (0-255)
          * @param g Green component (0-255)
          * @param b Blue component (0-255)
          * @param a Alpha component (0-255)
          * @param align Text alignment
          */
+        void RenderText(const std::string& text, int x, int y, FontHandle font,
+                       uint8_t r = 255, uint8_t g = 255, uint8_t b = 255, uint8_t a = 255,
+                       TextAlign align = TextAlign::Left);
         void RenderText(const std::string& text, int x, int y, const std::string& fontId,
                        uint8_t r = 255, uint8_t g = 255, uint8_t b = 255, uint8_t a = 255,
                        TextAlign align = TextAlign::Left);
@@ -65,26 +162,179 @@ namespace Match3
         /**
          * @brief Measure text width
          * @param text Text to measure
-         * @param fontId Font identifier
+         * @param font Font handle (or id, resolved per call)
          * @return Width in pixels, or -1 on error
          */
+        int MeasureText(const std::string& text, FontHandle font);
         int MeasureText(const std::string& text, const std::string& fontId);
 
         /**
          * @brief Get text height for a font
-         * @param fontId Font identifier
+         * @param font Font handle (or id, resolved per call)
          * @return Height in pixels, or -1 on error
          */
+        int GetTextHeight(FontHandle font);
         int GetTextHeight(const std::string& fontId);
 
+        /**
+         * @brief Rasterise text once into a standalone white texture
+         *
+         * For retained UI text: the caller owns the texture and tints it with
+         * colour/alpha mod, so only text or font changes require a new texture.
+         * @param text Text to render
+         * @param font Font handle (or id, resolved per call)
+         * @param texture Output texture
+         * @return true if successful
+         */
+        bool CreateTextTexture(const std::string& text, FontHandle font, Texture& texture);
+        bool CreateTextTexture(const std::string& text, const std::string& fontId, Texture& texture);
+
+        /**
+         * @brief Atlas glyphs for '0'-'9' and '-', for composing numbers without layout
+         *
+         * Page textures stay valid until ClearCaches() or Shutdown().
+         */
+        struct DigitGlyphs
+        {
+            std::array<Glyph, 10> digits;
+            Glyph minus;       // Blank if the font has no '-'
+            int advance = 0;   // Widest digit advance: fixed-width (tabular) slots
+            int height = 0;
+        };
+
+        /**
+         * @brief Rasterise (if needed) and return the digit strip of a font
+         * @param font Font handle (or id, resolved per call)
+         * @param digits Output glyphs
+         * @return true if every digit is available
+         */
+        bool GetDigitGlyphs(FontHandle font, DigitGlyphs& digits);
+        bool GetDigitGlyphs(const std::string& fontId, DigitGlyphs& digits);
+
+        /**
+         * @brief Drop all cached text runs and glyph atlases
+         */
+        void ClearCaches();
+
+        /**
+         * @brief Current memory usage of faces, atlases and cached runs
+         */
+        [[nodiscard]] MemoryStats GetMemoryStats() const;
+
+        /**
+         * @brief Log GetMemoryStats() at info level
+         */
+        void LogMemoryStats() const;
+
+        /**
+         * @brief Number of cached text runs
+         */
+        [[nodiscard]] size_t GetCachedRunCount() const { return m_runs.size(); }
+
+        /**
+         * @brief Save this frame's counters and reset them (once per presented frame)
+         */
+        void EndFrame();
+
+        /**
+         * @brief Counters of the last frame passed to EndFrame()
+         */
+        [[nodiscard]] const FrameStats& GetFrameStats() const { return m_lastFrameStats; }
+
         /**
          * @brief Shutdown and cleanup SDL_ttf
          */
         void Shutdown();
 
+        static constexpr size_t MAX_CACHED_RUNS = 256;
+
     private:
+        /**
+         * @brief A laid-out string: white quads relative to its top-left corner
+         */
+        struct TextRun
+        {
+            struct PageRange
+            {
+                SDL_Texture* texture;
+                int firstVertex;
+                int vertexCount;
+                int firstIndex;
+                int indexCount;
+            };
+
+            int width = 0;
+            int height = 0;
+            std::vector<SDL_Vertex> vertices;
+            std::vector<int> indices; // Relative to the owning page range
+            std::vector<PageRange> pages;
+        };
+
+        struct FontEntry
+        {
+            std::string id;
+            float size = 0.0f;
+            int height = 0;
+            std::unique_ptr<GlyphAtlas> atlas; // Filled lazily on first use of each glyph
+        };
+
+        struct CachedRun
+        {
+            std::string key;
+            TextRun run;
+        };
+
+        /**
+         * @brief Append a font to the array and index its id
+         */
+        FontEntry& AddEntry(const std::string& fontId);
+
+        /**
+         * @brief Entry for a handle
+         * @return nullptr for invalid or stale handles
+         */
+        FontEntry* GetEntry(FontHandle font);
+
+        /**
+         * @brief FindFont() that logs unknown ids (string overloads)
+         */
+        FontHandle Resolve(const std::string& fontId) const;
+
+        /**
+         * @brief Register a size variant of a face under fontId
+         */
+        bool AddFont(FontFace& face, int size, const std::string& fontId);
+
+        /**
+         * @brief Return the open face for a source, reading and parsing the file if needed
+         * @return Face owned by m_faces, or nullptr on failure
+         */
+        FontFace* OpenFace(const std::string& source, float size);
+
+        /**
+         * @brief Look up (or lay out and cache) a text run
+         * @return Run, or nullptr if the font is unknown
+         */
+        const TextRun* GetRun(const std::string& text, FontHandle font);
+
+        /**
+         * @brief Lay out a UTF-8 string using the font's glyph atlas
+         */
+        void LayoutRun(FontEntry& entry, const std::string& text, TextRun& run);
+
         SDL_Renderer* m_sdlRenderer; // Not owned
-        std::unordered_map<std::string, TTF_Font*> m_fonts;
+        std::vector<FontEntry> m_fonts;                                  // Indexed by FontHandle
+        ankerl::unordered_dense::map<std::string, FontHandle> m_fontIds; // Load time and tools only
+        ankerl::unordered_dense::map<std::string, std::unique_ptr<FontFace>> m_faces; // By source path
         bool m_initialized;
+
+        // LRU text-run cache: front is most recently used
+        std::list<CachedRun> m_runs;
+        ankerl::unordered_dense::map<std::string, std::list<CachedRun>::iterator> m_runIndex;
+        std::string m_keyScratch;
+        std::vector<SDL_Vertex> m_vertexScratch;
+
+        FrameStats m_stats;
+        FrameStats m_lastFrameStats;
     };
 } // namespace Match3
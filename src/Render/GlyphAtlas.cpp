@@ -0,0 +1,340 @@
+#include "GlyphAtlas.hpp"
+#include "FontFace.hpp"
+#include "Core/Logger.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace Match3
+{
+    namespace
+    {
+        uint64_t KerningKey(const uint32_t previous, const uint32_t codepoint)
+        {
+            return static_cast<uint64_t>(previous) << 32 | codepoint;
+        }
+    }
+
+    GlyphAtlas::GlyphAtlas(SDL_Renderer* sdlRenderer, FaceProvider faceProvider, const float size)
+        : m_sdlRenderer(sdlRenderer)
+          , m_faceProvider(std::move(faceProvider))
+          , m_size(size)
+    {
+    }
+
+    FontFace* GlyphAtlas::GetFace()
+    {
+        if (!m_faceRequested)
+        {
+            m_faceRequested = true;
+            m_face = m_faceProvider ? m_faceProvider() : nullptr;
+        }
+        return m_face;
+    }
+
+    const Glyph* GlyphAtlas::GetGlyph(const uint32_t codepoint)
+    {
+        if (const auto it = m_glyphs.find(codepoint); it != m_glyphs.end())
+        {
+            return &it->second;
+        }
+
+        FontFace* face = GetFace();
+        if (!face)
+        {
+            return nullptr;
+        }
+
+        TTF_Font* font = face->Bind(m_size);
+        int minX = 0, maxX = 0, minY = 0, maxY = 0, advance = 0;
+        if (!TTF_GetGlyphMetrics(font, codepoint, &minX, &maxX, &minY, &maxY, &advance))
+        {
+            LOG_WARN("Glyph U+{:04X} not available: {}", codepoint, SDL_GetError());
+            return nullptr;
+        }
+
+        Glyph glyph;
+        glyph.offsetX = static_cast<float>(std::min(0, minX));
+        glyph.advance = static_cast<float>(advance);
+
+        // Whitespace and other blank glyphs only advance the pen
+        SDL_Surface* rendered = TTF_RenderGlyph_Blended(font, codepoint, SDL_Color{255, 255, 255, 255});
+        if (!rendered)
+        {
+            return &m_glyphs.emplace(codepoint, glyph).first->second;
+        }
+
+        SDL_Surface* surface = rendered->format == SDL_PIXELFORMAT_ARGB8888
+                                   ? rendered
+                                   : SDL_ConvertSurface(rendered, SDL_PIXELFORMAT_ARGB8888);
+        if (!surface)
+        {
+            LOG_ERROR("Failed to convert glyph U+{:04X}: {}", codepoint, SDL_GetError());
+            SDL_DestroySurface(rendered);
+            return nullptr;
+        }
+
+        const int cellWidth = surface->w + PADDING * 2;
+        const int cellHeight = surface->h + PADDING * 2;
+
+        Texture* page = nullptr;
+        SDL_Point position = {0, 0};
+        if (!Allocate(cellWidth, cellHeight, page, position))
+        {
+            if (surface != rendered) SDL_DestroySurface(surface);
+            SDL_DestroySurface(rendered);
+            return nullptr;
+        }
+
+        // Copy into a zeroed, padded buffer so linear filtering never samples a neighbour
+        m_scratch.assign(static_cast<size_t>(cellWidth) * cellHeight, 0u);
+        const auto* src = static_cast<const uint8_t*>(surface->pixels);
+        for (int row = 0; row < surface->h; ++row)
+        {
+            std::memcpy(&m_scratch[static_cast<size_t>(row + PADDING) * cellWidth + PADDING],
+                        src + static_cast<size_t>(row) * surface->pitch,
+                        static_cast<size_t>(surface->w) * sizeof(uint32_t));
+        }
+
+        const SDL_Rect cell = {position.x, position.y, cellWidth, cellHeight};
+        page->Update(cell, m_scratch.data(), cellWidth * static_cast<int>(sizeof(uint32_t)));
+
+        glyph.page = page;
+        glyph.source = {
+            static_cast<float>(position.x + PADDING), static_cast<float>(position.y + PADDING),
+            static_cast<float>(surface->w), static_cast<float>(surface->h)
+        };
+
+        if (surface != rendered) SDL_DestroySurface(surface);
+        SDL_DestroySurface(rendered);
+
+        return &m_glyphs.emplace(codepoint, glyph).first->second;
+    }
+
+    int GlyphAtlas::GetKerning(const uint32_t previous, const uint32_t codepoint)
+    {
+        // Pairs inside the baked subset were all measured at bake time
+        if (m_bakedGlyphs.contains(previous) && m_bakedGlyphs.contains(codepoint))
+        {
+            const auto it = m_bakedKerning.find(KerningKey(previous, codepoint));
+            return it != m_bakedKerning.end() ? it->second : 0;
+        }
+
+        FontFace* face = GetFace();
+        int kerning = 0;
+        if (!face || !TTF_GetGlyphKerning(face->Bind(m_size), previous, codepoint, &kerning))
+        {
+            return 0;
+        }
+        return kerning;
+    }
+
+    bool GlyphAtlas::AddBaked(std::shared_ptr<const BakedFont> baked)
+    {
+        if (!baked || !m_pages.empty())
+        {
+            LOG_ERROR("Baked glyphs can only seed an empty atlas");
+            return false;
+        }
+
+        // Expand coverage to white ARGB, matching glyphs rasterised at runtime
+        if (baked->pageWidth > 0 && baked->pageHeight > 0)
+        {
+            m_scratch.resize(baked->coverage.size());
+            for (size_t i = 0; i < baked->coverage.size(); ++i)
+            {
+                m_scratch[i] = static_cast<uint32_t>(baked->coverage[i]) << 24 | 0x00FFFFFFu;
+            }
+
+            auto texture = std::make_unique<Texture>();
+            const SDL_Rect rect = {0, 0, baked->pageWidth, baked->pageHeight};
+            if (!texture->CreateBlank(m_sdlRenderer, baked->pageWidth, baked->pageHeight) ||
+                !texture->Update(rect, m_scratch.data(), baked->pageWidth * static_cast<int>(sizeof(uint32_t))))
+            {
+                LOG_ERROR("Failed to upload baked glyph page for '{}'", baked->id);
+                return false;
+            }
+            m_pages.push_back(std::move(texture));
+        }
+
+        Texture* page = m_pages.empty() ? nullptr : m_pages.back().get();
+        for (uint32_t i = 0; i < baked->glyphs.size(); ++i)
+        {
+            const BakedGlyph& source = baked->glyphs[i];
+            Glyph glyph;
+            glyph.offsetX = source.offsetX;
+            glyph.advance = source.advance;
+            if (source.width > 0 && source.height > 0)
+            {
+                glyph.page = page;
+                glyph.source = {
+                    static_cast<float>(source.x), static_cast<float>(source.y),
+                    static_cast<float>(source.width), static_cast<float>(source.height)
+                };
+            }
+            m_glyphs.emplace(source.codepoint, glyph);
+            m_bakedGlyphs.emplace(source.codepoint, i);
+        }
+
+        for (const auto& pair : baked->kerning)
+        {
+            m_bakedKerning.emplace(KerningKey(pair.first, pair.second), pair.amount);
+        }
+
+        // The baked page is full: glyphs rasterised later open a fresh page
+        m_shelfX = 0;
+        m_shelfY = PAGE_SIZE;
+        m_shelfHeight = 0;
+
+        m_baked = std::move(baked);
+        return true;
+    }
+
+    SDL_Surface* GlyphAtlas::RenderBaked(const std::string_view text, const int height) const
+    {
+        if (!m_baked || height <= 0)
+        {
+            return nullptr;
+        }
+
+        struct Placement
+        {
+            const BakedGlyph* glyph;
+            int x;
+        };
+
+        std::vector<Placement> placements;
+        placements.reserve(text.size());
+
+        int pen = 0;
+        int right = 0;
+        uint32_t previous = 0;
+
+        const char* cursor = text.data();
+        size_t remaining = text.size();
+        while (remaining > 0)
+        {
+            const uint32_t codepoint = SDL_StepUTF8(&cursor, &remaining);
+            if (codepoint == 0)
+                break;
+
+            const auto it = m_bakedGlyphs.find(codepoint);
+            if (it == m_bakedGlyphs.end())
+            {
+                return nullptr;
+            }
+            const BakedGlyph& glyph = m_baked->glyphs[it->second];
+
+            if (previous != 0)
+            {
+                const auto kerning = m_bakedKerning.find(KerningKey(previous, codepoint));
+                pen += kerning != m_bakedKerning.end() ? kerning->second : 0;
+            }
+
+            const int x = pen + glyph.offsetX;
+            placements.push_back({&glyph, x});
+            right = std::max(right, x + glyph.width);
+
+            pen += glyph.advance;
+            previous = codepoint;
+        }
+
+        const int width = std::max({pen, right, 1});
+        SDL_Surface* surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_ARGB8888);
+        if (!surface)
+        {
+            LOG_ERROR("Failed to create text surface: {}", SDL_GetError());
+            return nullptr;
+        }
+
+        // White with zero alpha so that overlapping cells only accumulate coverage
+        for (int row = 0; row < height; ++row)
+        {
+            auto* pixels = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(surface->pixels) + row * surface->pitch);
+            std::fill_n(pixels, width, 0x00FFFFFFu);
+        }
+
+        for (const auto& [glyph, x] : placements)
+        {
+            const int rows = std::min<int>(glyph->height, height);
+            for (int row = 0; row < rows; ++row)
+            {
+                auto* pixels = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(surface->pixels) + row * surface->pitch);
+                const uint8_t* coverage = &m_baked->coverage[static_cast<size_t>(glyph->y + row) * m_baked->pageWidth +
+                    glyph->x];
+                for (int column = 0; column < glyph->width; ++column)
+                {
+                    const int target = x + column;
+                    if (target < 0 || target >= width || coverage[column] == 0)
+                        continue;
+
+                    const uint32_t source = coverage[column];
+                    const uint32_t existing = pixels[target] >> 24;
+                    const uint32_t alpha = source + existing * (255u - source) / 255u;
+                    pixels[target] = alpha << 24 | 0x00FFFFFFu;
+                }
+            }
+        }
+
+        return surface;
+    }
+
+    size_t GlyphAtlas::GetPageBytes() const
+    {
+        size_t bytes = 0;
+        for (const auto& page : m_pages)
+        {
+            bytes += static_cast<size_t>(page->GetWidth()) * page->GetHeight() * sizeof(uint32_t);
+        }
+        return bytes;
+    }
+
+    void GlyphAtlas::Clear()
+    {
+        m_glyphs.clear();
+        m_pages.clear();
+        m_baked.reset();
+        m_bakedGlyphs.clear();
+        m_bakedKerning.clear();
+        m_shelfX = 0;
+        m_shelfY = 0;
+        m_shelfHeight = 0;
+    }
+
+    bool GlyphAtlas::Allocate(const int width, const int height, Texture*& page, SDL_Point& position)
+    {
+        if (width > PAGE_SIZE || height > PAGE_SIZE)
+        {
+            LOG_ERROR("Glyph cell {}x{} exceeds atlas page size {}", width, height, PAGE_SIZE);
+            return false;
+        }
+
+        // Next shelf when the current one is full
+        if (!m_pages.empty() && m_shelfX + width > PAGE_SIZE)
+        {
+            m_shelfY += m_shelfHeight;
+            m_shelfX = 0;
+            m_shelfHeight = 0;
+        }
+
+        // New page when there is no room for another shelf
+        if (m_pages.empty() || m_shelfY + height > PAGE_SIZE)
+        {
+            auto texture = std::make_unique<Texture>();
+            if (!texture->CreateBlank(m_sdlRenderer, PAGE_SIZE, PAGE_SIZE))
+            {
+                return false;
+            }
+            m_pages.push_back(std::move(texture));
+            m_shelfX = 0;
+            m_shelfY = 0;
+            m_shelfHeight = 0;
+            LOG_DEBUG("Glyph atlas: opened page {}", m_pages.size());
+        }
+
+        page = m_pages.back().get();
+        position = {m_shelfX, m_shelfY};
+        m_shelfX += width;
+        m_shelfHeight = std::max(m_shelfHeight, height);
+        return true;
+    }
+} // namespace Match3
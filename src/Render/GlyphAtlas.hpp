@@ -0,0 +1,136 @@
+#pragma once
+
+#include "BakedFont.hpp"
+#include "Texture.hpp"
+#include <SDL3/SDL.h>
+#include <ankerl/unordered_dense.h>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace Match3
+{
+    class FontFace;
+
+    /**
+     * @brief A glyph cell inside the atlas
+     *
+     * Cells are rasterised as single-character lines, so they span the full
+     * font height and are placed at (pen + offsetX, line top).
+     */
+    struct Glyph
+    {
+        Texture* page = nullptr;
+        SDL_FRect source = {0.0f, 0.0f, 0.0f, 0.0f};
+        float offsetX = 0.0f;
+        float advance = 0.0f;
+    };
+
+    /**
+     * @brief Glyph atlas for one loaded font (face + size)
+     *
+     * The face is shared with other sizes; the atlas binds its own size before
+     * every TTF call. Glyphs are rasterised in white on first use and packed into shelf-allocated
+     * atlas pages; colour is applied at draw time through vertex colours. Pages
+     * are only ever appended to, so page textures stay valid until Clear(); the
+     * Glyph records themselves may move when new glyphs are added, so callers
+     * that keep a glyph across GetGlyph() calls must copy it.
+     * Any Unicode codepoint the font covers works, including CJK.
+     *
+     * An atlas can be seeded from a pre-baked font: its coverage page is uploaded
+     * as the first page and its glyphs and kerning are served without touching
+     * the face. The face is only requested from the provider on the first glyph
+     * or kerning pair the baked subset does not cover.
+     */
+    class GlyphAtlas
+    {
+    public:
+        static constexpr int PAGE_SIZE = BakedFontFormat::MAX_PAGE_SIZE;
+        static constexpr int PADDING = 1;
+
+        /**
+         * @brief Returns the face to rasterise from, or nullptr if it cannot be opened
+         */
+        using FaceProvider = std::function<FontFace*()>;
+
+        GlyphAtlas(SDL_Renderer* sdlRenderer, FaceProvider faceProvider, float size);
+
+        // Disable copy
+        GlyphAtlas(const GlyphAtlas&) = delete;
+        GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+        /**
+         * @brief Get a glyph, rasterising it on first use
+         * @param codepoint Unicode codepoint
+         * @return Glyph (valid until the next GetGlyph() call), or nullptr if it could not be rasterised
+         */
+        const Glyph* GetGlyph(uint32_t codepoint);
+
+        /**
+         * @brief Kerning between two codepoints in pixels
+         */
+        [[nodiscard]] int GetKerning(uint32_t previous, uint32_t codepoint);
+
+        /**
+         * @brief Upload a baked font as the first page and register its glyphs
+         *
+         * Must be called on an empty atlas. The coverage is kept so that
+         * RenderBaked() can compose standalone text textures on the CPU.
+         * @return true if the page was uploaded
+         */
+        bool AddBaked(std::shared_ptr<const BakedFont> baked);
+
+        /**
+         * @brief Compose a white text surface from baked coverage only
+         * @param text UTF-8 text
+         * @param height Line height in pixels
+         * @return Surface owned by the caller, or nullptr if a glyph is not baked
+         */
+        SDL_Surface* RenderBaked(std::string_view text, int height) const;
+
+        /**
+         * @brief The face, requested from the provider on first call
+         */
+        FontFace* GetFace();
+
+        /**
+         * @brief Release all pages and glyphs, including baked ones
+         */
+        void Clear();
+
+        [[nodiscard]] size_t GetGlyphCount() const { return m_glyphs.size(); }
+        [[nodiscard]] size_t GetPageCount() const { return m_pages.size(); }
+        [[nodiscard]] size_t GetPageBytes() const;
+        [[nodiscard]] size_t GetBakedGlyphCount() const { return m_bakedGlyphs.size(); }
+        [[nodiscard]] size_t GetBakedBytes() const { return m_baked ? m_baked->coverage.size() : 0; }
+
+    private:
+        /**
+         * @brief Reserve a w x h cell, opening a new shelf or page as needed
+         */
+        bool Allocate(int width, int height, Texture*& page, SDL_Point& position);
+
+        SDL_Renderer* m_sdlRenderer; // Not owned
+        FaceProvider m_faceProvider;
+        FontFace* m_face = nullptr;  // Not owned, shared across sizes
+        bool m_faceRequested = false;
+        float m_size;
+
+        // Baked subset: coverage, codepoint -> index into m_baked->glyphs, packed kerning pairs
+        std::shared_ptr<const BakedFont> m_baked;
+        ankerl::unordered_dense::map<uint32_t, uint32_t> m_bakedGlyphs;
+        ankerl::unordered_dense::map<uint64_t, int> m_bakedKerning;
+
+        std::vector<std::unique_ptr<Texture>> m_pages;
+        ankerl::unordered_dense::map<uint32_t, Glyph> m_glyphs;
+
+        // Shelf packer state for the current (last) page
+        int m_shelfX = 0;
+        int m_shelfY = 0;
+        int m_shelfHeight = 0;
+
+        std::vector<uint32_t> m_scratch; // Padded upload buffer
+    };
+} // namespace Match3
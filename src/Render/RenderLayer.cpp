@@ -0,0 +1,81 @@
+#include "RenderLayer.hpp"
+#include "Renderer.hpp"
+#include "Core/Logger.hpp"
+
+namespace Match3
+{
+    RenderLayer::RenderLayer(Renderer* renderer, DrawCallback draw)
+        : m_renderer(renderer)
+          , m_draw(std::move(draw))
+    {
+    }
+
+    void RenderLayer::Composite(const int width, const int height)
+    {
+        if (width <= 0 || height <= 0)
+        {
+            return;
+        }
+
+        if (m_dirty || !m_texture.IsValid() ||
+            m_texture.GetWidth() != width || m_texture.GetHeight() != height)
+        {
+            if (!Redraw(width, height))
+            {
+                // 渲染目标不可用时直接绘制到屏幕
+                m_draw(*m_renderer);
+                return;
+            }
+        }
+
+        m_renderer->DrawTexture(m_texture, {0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height)});
+    }
+
+    bool RenderLayer::Redraw(const int width, const int height)
+    {
+        SDL_Renderer* sdlRenderer = m_renderer->GetSDLRenderer();
+
+        if (!m_texture.IsValid() || m_texture.GetWidth() != width || m_texture.GetHeight() != height)
+        {
+            if (!m_texture.CreateRenderTarget(sdlRenderer, width, height))
+            {
+                return false;
+            }
+        }
+
+        // 已入队的内容属于当前目标，切换前先提交
+        m_renderer->FlushQueue();
+
+        SDL_Texture* previousTarget = SDL_GetRenderTarget(sdlRenderer);
+        if (!SDL_SetRenderTarget(sdlRenderer, m_texture.GetSDLTexture()))
+        {
+            LOG_ERROR("RenderLayer: Failed to set render target: {}", SDL_GetError());
+            return false;
+        }
+
+        const bool wasQueueing = m_renderer->IsQueueing();
+        if (!wasQueueing)
+        {
+            m_renderer->BeginQueue();
+        }
+
+        m_renderer->Clear(0, 0, 0, 0);
+        m_draw(*m_renderer);
+
+        if (wasQueueing)
+        {
+            m_renderer->FlushQueue();
+        }
+        else
+        {
+            m_renderer->EndQueue();
+        }
+
+        SDL_SetRenderTarget(sdlRenderer, previousTarget);
+
+        m_dirty = false;
+        ++m_redrawCount;
+        LOG_DEBUG("RenderLayer: Redrawn at {}x{} ({} times)", width, height, m_redrawCount);
+        return true;
+    }
+} // namespace Match3
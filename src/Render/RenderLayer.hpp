@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Texture.hpp"
+#include <functional>
+
+namespace Match3
+{
+    class Renderer;
+
+    /**
+     * @brief 缓存图层 - 将静态内容（背景、网格、面板）渲染到目标纹理，每帧只需一次贴图
+     *
+     * 只有在 Invalidate()、尺寸变化或首次使用时才会调用绘制回调重新生成纹理。
+     */
+    class RenderLayer
+    {
+    public:
+        using DrawCallback = std::function<void(Renderer&)>;
+
+        RenderLayer(Renderer* renderer, DrawCallback draw);
+
+        // 禁止拷贝
+        RenderLayer(const RenderLayer&) = delete;
+        RenderLayer& operator=(const RenderLayer&) = delete;
+
+        /**
+         * @brief 标记内容失效，下次 Composite() 时重新绘制
+         */
+        void Invalidate() { m_dirty = true; }
+
+        /**
+         * @brief 必要时重新绘制，然后把图层贴到 (0, 0, width, height)
+         * @param width 图层宽度（场景坐标）
+         * @param height 图层高度（场景坐标）
+         */
+        void Composite(int width, int height);
+
+        /**
+         * @brief 图层被重新绘制的次数（用于统计）
+         */
+        [[nodiscard]] int GetRedrawCount() const { return m_redrawCount; }
+
+    private:
+        /**
+         * @brief 重新生成图层纹理
+         */
+        bool Redraw(int width, int height);
+
+        Renderer* m_renderer; // 不拥有所有权
+        DrawCallback m_draw;
+        Texture m_texture;
+        bool m_dirty = true;
+        int m_redrawCount = 0;
+    };
+} // namespace Match3
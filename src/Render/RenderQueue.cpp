@@ -0,0 +1,296 @@
+#include "RenderQueue.hpp"
+#include "Core/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Match3
+{
+    namespace
+    {
+        SDL_FColor ToFColor(const SDL_Color color)
+        {
+            return {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+        }
+
+        bool Overlaps(const SDL_FRect& a, const SDL_FRect& b)
+        {
+            return a.x < b.x + b.w && b.x < a.x + a.w &&
+                   a.y < b.y + b.h && b.y < a.y + a.h;
+        }
+
+        SDL_FRect Union(const SDL_FRect& a, const SDL_FRect& b)
+        {
+            const float left = std::min(a.x, b.x);
+            const float top = std::min(a.y, b.y);
+            const float right = std::max(a.x + a.w, b.x + b.w);
+            const float bottom = std::max(a.y + a.h, b.y + b.h);
+            return {left, top, right - left, bottom - top};
+        }
+    } // namespace
+
+    bool RenderQueue::State::operator==(const State& other) const
+    {
+        if (kind != other.kind || texture != other.texture || blendMode != other.blendMode)
+        {
+            return false;
+        }
+        if (kind != Kind::Line)
+        {
+            return true;
+        }
+        return lineColor.r == other.lineColor.r && lineColor.g == other.lineColor.g &&
+               lineColor.b == other.lineColor.b && lineColor.a == other.lineColor.a;
+    }
+
+    RenderQueue::RenderQueue(SDL_Renderer* renderer)
+        : m_renderer(renderer)
+    {
+        m_commands.reserve(256);
+    }
+
+    void RenderQueue::AddRect(const int layer, const SDL_FRect& rect, const SDL_Color color,
+                              const SDL_BlendMode blendMode)
+    {
+        if (rect.w <= 0.0f || rect.h <= 0.0f || color.a == 0)
+        {
+            return;
+        }
+
+        Command command{};
+        command.layer = layer;
+        command.state.kind = Kind::Solid;
+        command.state.blendMode = blendMode;
+        command.dest = rect;
+        command.color = ToFColor(color);
+        Push(command);
+    }
+
+    void RenderQueue::AddLine(const int layer, const float x1, const float y1, const float x2, const float y2,
+                              const SDL_Color color, const SDL_BlendMode blendMode)
+    {
+        // 水平/垂直线：与 SDL_RenderLine 相同，包含两个端点
+        if (y1 == y2 || x1 == x2)
+        {
+            const float left = std::min(x1, x2);
+            const float top = std::min(y1, y2);
+            AddRect(layer, {left, top, std::abs(x2 - x1) + 1.0f, std::abs(y2 - y1) + 1.0f}, color, blendMode);
+            return;
+        }
+
+        if (color.a == 0)
+        {
+            return;
+        }
+
+        Command command{};
+        command.layer = layer;
+        command.state.kind = Kind::Line;
+        command.state.blendMode = blendMode;
+        command.state.lineColor = color;
+        command.dest = {std::min(x1, x2), std::min(y1, y2), std::abs(x2 - x1) + 1.0f, std::abs(y2 - y1) + 1.0f};
+        command.x1 = x1;
+        command.y1 = y1;
+        command.x2 = x2;
+        command.y2 = y2;
+        Push(command);
+    }
+
+    void RenderQueue::AddQuad(const int layer, SDL_Texture* texture, const SDL_FRect* source, const SDL_FRect& dest,
+                              const SDL_Color color, const SDL_BlendMode blendMode)
+    {
+        if (!texture || dest.w <= 0.0f || dest.h <= 0.0f || color.a == 0)
+        {
+            return;
+        }
+
+        Command command{};
+        command.layer = layer;
+        command.state.kind = Kind::Textured;
+        command.state.texture = texture;
+        command.state.blendMode = blendMode;
+        command.dest = dest;
+        command.color = ToFColor(color);
+
+        // 源区域归一化为纹理坐标
+        command.source = {0.0f, 0.0f, 1.0f, 1.0f};
+        if (source)
+        {
+            float width = 0.0f;
+            float height = 0.0f;
+            if (SDL_GetTextureSize(texture, &width, &height) && width > 0.0f && height > 0.0f)
+            {
+                command.source = {source->x / width, source->y / height, source->w / width, source->h / height};
+            }
+        }
+        Push(command);
+    }
+
+    void RenderQueue::Push(Command command)
+    {
+        command.sequence = static_cast<uint32_t>(m_commands.size());
+        m_commands.push_back(command);
+        ++m_stats.commands;
+    }
+
+    void RenderQueue::Submit()
+    {
+        if (m_commands.empty())
+        {
+            return;
+        }
+
+        // 1. 按图层稳定排序（同层保持提交顺序）
+        std::ranges::stable_sort(m_commands, {}, &Command::layer);
+
+        // 2. 逐图层分配批次
+        m_nextBatch = 0;
+        size_t first = 0;
+        while (first < m_commands.size())
+        {
+            size_t last = first + 1;
+            while (last < m_commands.size() && m_commands[last].layer == m_commands[first].layer)
+            {
+                ++last;
+            }
+            AssignBatches(first, last);
+            first = last;
+        }
+
+        // 3. 按批次稳定排序（批次号随图层递增，批次内保持提交顺序）
+        std::ranges::stable_sort(m_commands, {}, &Command::batch);
+
+        // 4. 逐批提交
+        first = 0;
+        while (first < m_commands.size())
+        {
+            size_t last = first + 1;
+            while (last < m_commands.size() && m_commands[last].batch == m_commands[first].batch)
+            {
+                ++last;
+            }
+            SubmitBatch(first, last);
+            first = last;
+        }
+
+        m_commands.clear();
+    }
+
+    void RenderQueue::AssignBatches(const size_t first, const size_t last)
+    {
+        m_batches.clear();
+
+        for (size_t i = first; i < last; ++i)
+        {
+            Command& command = m_commands[i];
+
+            // 向前查找同状态批次，途经的批次不能与命令相交
+            int target = -1;
+            const int stop = std::max(0, static_cast<int>(m_batches.size()) - MAX_MERGE_DISTANCE);
+            for (int b = static_cast<int>(m_batches.size()) - 1; b >= stop; --b)
+            {
+                if (m_batches[b].state == command.state)
+                {
+                    target = b;
+                    break;
+                }
+                if (Overlaps(m_batches[b].bounds, command.dest))
+                {
+                    break;
+                }
+            }
+
+            if (target < 0)
+            {
+                m_batches.push_back({command.state, command.dest});
+                target = static_cast<int>(m_batches.size()) - 1;
+            }
+            else
+            {
+                m_batches[target].bounds = Union(m_batches[target].bounds, command.dest);
+            }
+
+            command.batch = m_nextBatch + static_cast<uint32_t>(target);
+        }
+
+        m_nextBatch += static_cast<uint32_t>(m_batches.size());
+    }
+
+    void RenderQueue::SubmitBatch(const size_t first, const size_t last)
+    {
+        const State& state = m_commands[first].state;
+
+        if (!m_hasLastState || !(m_lastState == state))
+        {
+            ++m_stats.stateChanges;
+        }
+        m_lastState = state;
+        m_hasLastState = true;
+        ++m_stats.batches;
+
+        if (state.kind == Kind::Line)
+        {
+            SDL_SetRenderDrawBlendMode(m_renderer, state.blendMode);
+            SDL_SetRenderDrawColor(m_renderer, state.lineColor.r, state.lineColor.g,
+                                   state.lineColor.b, state.lineColor.a);
+            for (size_t i = first; i < last; ++i)
+            {
+                const Command& command = m_commands[i];
+                SDL_RenderLine(m_renderer, command.x1, command.y1, command.x2, command.y2);
+            }
+            m_stats.vertices += static_cast<int>(last - first) * 2;
+            m_stats.lines += static_cast<int>(last - first);
+            m_stats.drawCalls += static_cast<int>(last - first);
+            return;
+        }
+
+        m_vertices.clear();
+        m_indices.clear();
+        for (size_t i = first; i < last; ++i)
+        {
+            const Command& command = m_commands[i];
+            const float x0 = command.dest.x;
+            const float y0 = command.dest.y;
+            const float x1 = command.dest.x + command.dest.w;
+            const float y1 = command.dest.y + command.dest.h;
+            const float u0 = command.source.x;
+            const float v0 = command.source.y;
+            const float u1 = command.source.x + command.source.w;
+            const float v1 = command.source.y + command.source.h;
+
+            const int base = static_cast<int>(m_vertices.size());
+            m_vertices.push_back({{x0, y0}, command.color, {u0, v0}});
+            m_vertices.push_back({{x1, y0}, command.color, {u1, v0}});
+            m_vertices.push_back({{x1, y1}, command.color, {u1, v1}});
+            m_vertices.push_back({{x0, y1}, command.color, {u0, v1}});
+            m_indices.insert(m_indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+
+        if (state.texture)
+        {
+            // 调制由顶点颜色完成
+            SDL_SetTextureColorMod(state.texture, 255, 255, 255);
+            SDL_SetTextureAlphaMod(state.texture, 255);
+            SDL_SetTextureBlendMode(state.texture, state.blendMode);
+        }
+        else
+        {
+            SDL_SetRenderDrawBlendMode(m_renderer, state.blendMode);
+        }
+
+        if (!SDL_RenderGeometry(m_renderer, state.texture,
+                                m_vertices.data(), static_cast<int>(m_vertices.size()),
+                                m_indices.data(), static_cast<int>(m_indices.size())))
+        {
+            LOG_ERROR("RenderQueue: SDL_RenderGeometry failed: {}", SDL_GetError());
+        }
+        ++m_stats.drawCalls;
+        m_stats.vertices += static_cast<int>(m_vertices.size());
+    }
+
+    void RenderQueue::EndFrame()
+    {
+        m_lastFrameStats = m_stats;
+        m_stats = {};
+        m_hasLastState = false;
+    }
+} // namespace Match3
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <vector>
+
+namespace Match3
+{
+    /**
+     * @brief 渲染命令队列 - 收集一帧的绘制命令，排序合并后统一提交
+     *
+     * 支持三类命令：
+     * - 纯色矩形（实心矩形、矩形边框、水平/垂直线都转换为矩形）
+     * - 斜线（无法转换为矩形，按颜色分批）
+     * - 纹理四边形（精灵、文字纹理、缓存图层）
+     *
+     * 提交时先按图层稳定排序；同一图层内，命令只会被前移并入与其状态相同
+     * （纹理、混合模式、线条颜色）的更早批次，且途经的其他状态批次不能与其
+     * 包围盒相交——因此重叠内容的先后顺序不变，不相交的内容才会被合并。
+     * 纯色矩形与纹理四边形都以顶点颜色着色，每批一次 SDL_RenderGeometry。
+     */
+    class RenderQueue
+    {
+    public:
+        /**
+         * @brief 每帧统计
+         */
+        struct Stats
+        {
+            int commands = 0;     // 入队命令数
+            int batches = 0;      // 合并后的提交次数
+            int stateChanges = 0; // 纹理/混合模式/颜色切换次数
+            int vertices = 0;     // 提交的顶点数
+            int drawCalls = 0;    // SDL 绘制调用次数（直线批次每条一次，其余每批一次）
+            int lines = 0;        // 提交的直线数
+        };
+
+        /// 同一图层内向前查找可合并批次的最大距离（限制最坏情况开销）
+        static constexpr int MAX_MERGE_DISTANCE = 64;
+
+        explicit RenderQueue(SDL_Renderer* renderer);
+
+        // 禁止拷贝
+        RenderQueue(const RenderQueue&) = delete;
+        RenderQueue& operator=(const RenderQueue&) = delete;
+
+        /**
+         * @brief 添加纯色实心矩形
+         */
+        void AddRect(int layer, const SDL_FRect& rect, SDL_Color color, SDL_BlendMode blendMode);
+
+        /**
+         * @brief 添加直线（水平/垂直线转换为 1 像素矩形）
+         */
+        void AddLine(int layer, float x1, float y1, float x2, float y2, SDL_Color color, SDL_BlendMode blendMode);
+
+        /**
+         * @brief 添加纹理四边形
+         * @param source 源区域，nullptr 表示整张纹理
+         */
+        void AddQuad(int layer, SDL_Texture* texture, const SDL_FRect* source, const SDL_FRect& dest,
+                     SDL_Color color, SDL_BlendMode blendMode);
+
+        /**
+         * @brief 排序、合并并提交所有命令，然后清空队列（保留容量）
+         */
+        void Submit();
+
+        /**
+         * @brief 是否有待提交的命令
+         */
+        [[nodiscard]] bool IsEmpty() const { return m_commands.empty(); }
+
+        /**
+         * @brief 结束一帧：保存本帧统计并清零（由 Renderer::Present 调用）
+         */
+        void EndFrame();
+
+        /**
+         * @brief 获取上一帧的统计
+         */
+        [[nodiscard]] const Stats& GetFrameStats() const { return m_lastFrameStats; }
+
+    private:
+        enum class Kind : uint8_t
+        {
+            Solid,   // 纯色几何
+            Line,    // 斜线
+            Textured // 纹理几何
+        };
+
+        /**
+         * @brief 批次状态 - 状态相同的命令可以合并为一次提交
+         */
+        struct State
+        {
+            Kind kind = Kind::Solid;
+            SDL_Texture* texture = nullptr;
+            SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+            SDL_Color lineColor = {0, 0, 0, 0}; // 仅 Line 使用
+
+            bool operator==(const State& other) const;
+        };
+
+        struct Command
+        {
+            int layer;
+            uint32_t sequence;
+            uint32_t batch;
+            State state;
+            SDL_FRect dest;   // 矩形/四边形目标区域，也是包围盒
+            SDL_FRect source; // 纹理坐标（已归一化）
+            SDL_FColor color;
+            float x1, y1, x2, y2; // 仅 Line 使用
+        };
+
+        struct Batch
+        {
+            State state;
+            SDL_FRect bounds;
+        };
+
+        /**
+         * @brief 为同一图层的命令 [first, last) 分配批次号
+         */
+        void AssignBatches(size_t first, size_t last);
+
+        /**
+         * @brief 提交一个批次的命令 [first, last)
+         */
+        void SubmitBatch(size_t first, size_t last);
+
+        void Push(Command command);
+
+        SDL_Renderer* m_renderer; // 不拥有所有权
+
+        std::vector<Command> m_commands;
+        std::vector<Batch> m_batches;
+        std::vector<SDL_Vertex> m_vertices;
+        std::vector<int> m_indices;
+        uint32_t m_nextBatch = 0;
+
+        // 最近一次提交的状态（用于统计状态切换）
+        State m_lastState;
+        bool m_hasLastState = false;
+
+        Stats m_stats;
+        Stats m_lastFrameStats;
+    };
+} // namespace Match3
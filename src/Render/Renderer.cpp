@@ -1,26 +1,170 @@
 #include "Renderer.hpp"
+#include "Texture.hpp"
+#include "Core/Logger.hpp"
 #include <cmath>
 
 namespace Match3
 {
     Renderer::Renderer(SDL_Renderer* sdlRenderer)
         : m_sdlRenderer(sdlRenderer)
+        , m_spriteBatch(std::make_unique<SpriteBatch>(sdlRenderer))
+        , m_queue(std::make_unique<RenderQueue>(sdlRenderer))
     {
     }
 
+    Renderer::~Renderer() = default;
+
+    bool Renderer::EnableLogicalTarget(const int width, const int height)
+    {
+        auto target = std::make_unique<Texture>();
+        if (!target->CreateRenderTarget(m_sdlRenderer, width, height))
+        {
+            LOG_WARN("Renderer: Logical target {}x{} unavailable - rendering at window resolution", width, height);
+            return false;
+        }
+        target->SetScaleMode(SDL_SCALEMODE_LINEAR);
+        // 逻辑画面整体覆盖黑边背景，不需要再混合
+        SDL_SetTextureBlendMode(target->GetSDLTexture(), SDL_BLENDMODE_NONE);
+
+        FlushQueue();
+        if (!SDL_SetRenderTarget(m_sdlRenderer, target->GetSDLTexture()))
+        {
+            LOG_WARN("Renderer: Failed to bind logical target: {}", SDL_GetError());
+            return false;
+        }
+
+        m_logicalTarget = std::move(target);
+        m_presentRect = {0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height)};
+        LOG_INFO("Renderer: Rendering at logical resolution {}x{}", width, height);
+        return true;
+    }
+
+    void Renderer::SetPresentRect(const SDL_FRect& dest, const SDL_ScaleMode scaleMode)
+    {
+        m_presentRect = dest;
+        if (m_logicalTarget)
+        {
+            m_logicalTarget->SetScaleMode(scaleMode);
+        }
+    }
+
+    SpriteBatch& Renderer::GetSpriteBatch()
+    {
+        FlushQueue();
+        return *m_spriteBatch;
+    }
+
+    void Renderer::BeginQueue()
+    {
+        m_queueing = true;
+        m_layer = 0;
+    }
+
+    void Renderer::FlushQueue()
+    {
+        if (m_queue->IsEmpty())
+        {
+            return;
+        }
+
+        SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+        SDL_GetRenderDrawBlendMode(m_sdlRenderer, &blendMode);
+
+        m_queue->Submit();
+
+        // 队列提交会修改绘制颜色/混合模式，恢复调用方的状态
+        SDL_SetRenderDrawBlendMode(m_sdlRenderer, blendMode);
+        SDL_SetRenderDrawColor(m_sdlRenderer, m_drawColor.r, m_drawColor.g, m_drawColor.b, m_drawColor.a);
+    }
+
+    void Renderer::EndQueue()
+    {
+        FlushQueue();
+        m_queueing = false;
+        m_layer = 0;
+    }
+
     void Renderer::Clear(const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a)
     {
+        // 清屏之前入队的内容已无意义
+        FlushQueue();
         SDL_SetRenderDrawColor(m_sdlRenderer, r, g, b, a);
         SDL_RenderClear(m_sdlRenderer);
+        m_drawColor = {r, g, b, a};
     }
 
     void Renderer::Present()
     {
+        FlushQueue();
+        m_spriteBatch->End();
+
+        if (m_overlay)
+        {
+            // 叠加层用立即模式，文字（直接提交）与背景矩形按调用顺序叠放
+            const bool queueing = m_queueing;
+            m_queueing = false;
+            m_overlay(*this);
+            m_queueing = queueing;
+            m_spriteBatch->End();
+        }
+
+        if (m_logicalTarget)
+        {
+            // 一次缩放贴图到窗口，呈现区域以外清成黑边
+            SDL_SetRenderTarget(m_sdlRenderer, nullptr);
+            SDL_SetRenderDrawColor(m_sdlRenderer, 0, 0, 0, 255);
+            SDL_RenderClear(m_sdlRenderer);
+            SDL_RenderTexture(m_sdlRenderer, m_logicalTarget->GetSDLTexture(), nullptr, &m_presentRect);
+            ++m_stats.drawCalls;
+            ++m_stats.textureDraws;
+        }
+
+        EndFrameStats();
+
+        if (m_presentHook)
+        {
+            m_presentHook(m_sdlRenderer);
+        }
+
+        // SDL_Renderer 不提供 GPU 计时查询，呈现调用的耗时是最接近 GPU 端负载的指标
+        const uint64_t presentStart = SDL_GetTicksNS();
         SDL_RenderPresent(m_sdlRenderer);
+        m_lastFrameStats.presentMs = static_cast<float>(SDL_GetTicksNS() - presentStart) / 1'000'000.0f;
+
+        if (m_logicalTarget)
+        {
+            SDL_SetRenderTarget(m_sdlRenderer, m_logicalTarget->GetSDLTexture());
+            SDL_SetRenderDrawColor(m_sdlRenderer, m_drawColor.r, m_drawColor.g, m_drawColor.b, m_drawColor.a);
+        }
+    }
+
+    void Renderer::EndFrameStats()
+    {
+        m_spriteBatch->EndFrame();
+        m_queue->EndFrame();
+
+        const SpriteBatch::Stats& batch = m_spriteBatch->GetFrameStats();
+        const RenderQueue::Stats& queue = m_queue->GetFrameStats();
+        m_stats.drawCalls += m_stats.points + batch.drawCalls + queue.drawCalls;
+        m_stats.textureDraws += batch.sprites;
+        m_stats.batches = batch.drawCalls + queue.batches;
+        m_stats.stateChanges = queue.stateChanges;
+        m_stats.vertices = batch.vertices + queue.vertices;
+
+        const uint64_t created = Texture::GetCreatedCount();
+        const uint64_t destroyed = Texture::GetDestroyedCount();
+        m_stats.texturesCreated = static_cast<int>(created - m_texturesCreatedMark);
+        m_stats.texturesDestroyed = static_cast<int>(destroyed - m_texturesDestroyedMark);
+        m_texturesCreatedMark = created;
+        m_texturesDestroyedMark = destroyed;
+
+        m_lastFrameStats = m_stats;
+        m_stats = {};
     }
 
     void Renderer::SetDrawColor(const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a)
     {
+        m_drawColor = {r, g, b, a};
         SDL_SetRenderDrawColor(m_sdlRenderer, r, g, b, a);
     }
 
@@ -28,25 +172,65 @@ namespace Match3
     {
         const SDL_FRect rect = {static_cast<float>(x), static_cast<float>(y),
                                 static_cast<float>(w), static_cast<float>(h)};
+        ++m_stats.rects;
+        if (m_queueing)
+        {
+            m_queue->AddRect(m_layer, rect, m_drawColor, SDL_BLENDMODE_BLEND);
+            return;
+        }
         SDL_RenderFillRect(m_sdlRenderer, &rect);
+        ++m_stats.drawCalls;
     }
 
     void Renderer::DrawRect(const int x, const int y, const int w, const int h)
     {
         const SDL_FRect rect = {static_cast<float>(x), static_cast<float>(y),
                                 static_cast<float>(w), static_cast<float>(h)};
+        ++m_stats.rects;
+        if (m_queueing)
+        {
+            // 边框拆成四条 1 像素矩形，可与实心矩形合并
+            if (w <= 0 || h <= 0) return;
+            const float fx = rect.x, fy = rect.y, fw = rect.w, fh = rect.h;
+            m_queue->AddRect(m_layer, {fx, fy, fw, 1.0f}, m_drawColor, SDL_BLENDMODE_BLEND);
+            if (h > 1)
+            {
+                m_queue->AddRect(m_layer, {fx, fy + fh - 1.0f, fw, 1.0f}, m_drawColor, SDL_BLENDMODE_BLEND);
+            }
+            if (h > 2)
+            {
+                m_queue->AddRect(m_layer, {fx, fy + 1.0f, 1.0f, fh - 2.0f}, m_drawColor, SDL_BLENDMODE_BLEND);
+                if (w > 1)
+                {
+                    m_queue->AddRect(m_layer, {fx + fw - 1.0f, fy + 1.0f, 1.0f, fh - 2.0f},
+                                     m_drawColor, SDL_BLENDMODE_BLEND);
+                }
+            }
+            return;
+        }
         SDL_RenderRect(m_sdlRenderer, &rect);
+        ++m_stats.drawCalls;
     }
 
     void Renderer::DrawLine(const int x1, const int y1, const int x2, const int y2)
     {
+        ++m_stats.lines;
+        if (m_queueing)
+        {
+            m_queue->AddLine(m_layer, static_cast<float>(x1), static_cast<float>(y1),
+                             static_cast<float>(x2), static_cast<float>(y2), m_drawColor, SDL_BLENDMODE_BLEND);
+            return;
+        }
         SDL_RenderLine(m_sdlRenderer,
                        static_cast<float>(x1), static_cast<float>(y1),
                        static_cast<float>(x2), static_cast<float>(y2));
+        ++m_stats.drawCalls;
     }
 
     void Renderer::FillCircle(const int centerX, const int centerY, const int radius)
     {
+        FlushQueue();
+
         // 使用中点圆算法绘制实心圆
         for (int y = -radius; y <= radius; y++)
         {
@@ -57,6 +241,7 @@ namespace Match3
                     SDL_RenderPoint(m_sdlRenderer,
                                     static_cast<float>(centerX + x),
                                     static_cast<float>(centerY + y));
+                    ++m_stats.points;
                 }
             }
         }
@@ -66,12 +251,14 @@ namespace Match3
                                        const uint8_t r, const uint8_t g, const uint8_t b, const float alpha)
     {
         const auto alphaValue = static_cast<uint8_t>(255 * alpha);
-        SDL_SetRenderDrawColor(m_sdlRenderer, r, g, b, alphaValue);
+        SetDrawColor(r, g, b, alphaValue);
         FillCircle(centerX, centerY, radius);
     }
 
     void Renderer::DrawCircle(const int centerX, const int centerY, const int radius)
     {
+        FlushQueue();
+
         // 使用 Bresenham 圆算法绘制空心圆
         int x = 0;
         int y = radius;
@@ -87,6 +274,7 @@ namespace Match3
             SDL_RenderPoint(m_sdlRenderer, static_cast<float>(cx - py), static_cast<float>(cy + px));
             SDL_RenderPoint(m_sdlRenderer, static_cast<float>(cx + py), static_cast<float>(cy - px));
             SDL_RenderPoint(m_sdlRenderer, static_cast<float>(cx - py), static_cast<float>(cy - px));
+            m_stats.points += 8;
         };
 
         while (y >= x)
@@ -105,4 +293,74 @@ namespace Match3
             }
         }
     }
+
+    void Renderer::DrawSprite(const Sprite& sprite, const float centerX, const float centerY, const float radius,
+                              const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a)
+    {
+        if (!sprite.IsValid() || sprite.radius <= 0.0f || radius <= 0.0f)
+        {
+            return;
+        }
+
+        // 源区域按 radius / sprite.radius 等比缩放
+        const float scale = radius / sprite.radius;
+        const float width = sprite.source.w * scale;
+        const float height = sprite.source.h * scale;
+        const SDL_FRect destRect = {centerX - width * 0.5f, centerY - height * 0.5f, width, height};
+
+        ++m_stats.textureDraws;
+        if (m_queueing)
+        {
+            m_queue->AddQuad(m_layer, sprite.texture->GetSDLTexture(), &sprite.source, destRect,
+                             {r, g, b, a}, SDL_BLENDMODE_BLEND);
+            return;
+        }
+
+        sprite.texture->SetColorMod(r, g, b);
+        sprite.texture->SetAlpha(a);
+        SDL_RenderTexture(m_sdlRenderer, sprite.texture->GetSDLTexture(), &sprite.source, &destRect);
+        ++m_stats.drawCalls;
+    }
+
+    void Renderer::DrawTexture(const Texture& texture, const SDL_FRect& dest,
+                               const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a)
+    {
+        if (!texture.IsValid())
+        {
+            return;
+        }
+
+        ++m_stats.textureDraws;
+        if (m_queueing)
+        {
+            m_queue->AddQuad(m_layer, texture.GetSDLTexture(), nullptr, dest, {r, g, b, a}, SDL_BLENDMODE_BLEND);
+            return;
+        }
+
+        SDL_SetTextureColorMod(texture.GetSDLTexture(), r, g, b);
+        SDL_SetTextureAlphaMod(texture.GetSDLTexture(), a);
+        SDL_RenderTexture(m_sdlRenderer, texture.GetSDLTexture(), nullptr, &dest);
+        ++m_stats.drawCalls;
+    }
+
+    void Renderer::DrawTexture(const Texture& texture, const SDL_FRect& source, const SDL_FRect& dest,
+                               const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a)
+    {
+        if (!texture.IsValid())
+        {
+            return;
+        }
+
+        ++m_stats.textureDraws;
+        if (m_queueing)
+        {
+            m_queue->AddQuad(m_layer, texture.GetSDLTexture(), &source, dest, {r, g, b, a}, SDL_BLENDMODE_BLEND);
+            return;
+        }
+
+        SDL_SetTextureColorMod(texture.GetSDLTexture(), r, g, b);
+        SDL_SetTextureAlphaMod(texture.GetSDLTexture(), a);
+        SDL_RenderTexture(m_sdlRenderer, texture.GetSDLTexture(), &source, &dest);
+        ++m_stats.drawCalls;
+    }
 } // namespace Match3
@@ -1,19 +1,54 @@
 #pragma once
 
 #include <SDL3/SDL.h>
+#include <functional>
 #include <memory>
 #include <optional>
+#include "Sprite.hpp"
+#include "SpriteBatch.hpp"
+#include "RenderQueue.hpp"
 
 namespace Match3
 {
+    class ResourceManager;
+    class Texture;
+
     /**
      * @brief 渲染器封装类 - 提供便捷的渲染接口
+     *
+     * 默认为立即模式。BeginQueue() 之后矩形、直线、精灵和纹理绘制进入
+     * RenderQueue，在 FlushQueue()/EndQueue()/Present() 时排序合并提交；
+     * 逐像素圆形等立即模式绘制会先提交队列，保证绘制顺序不变。
+     *
+     * 启用逻辑分辨率目标后，所有绘制落在固定尺寸的离屏纹理上，
+     * Present() 时一次缩放贴到窗口的呈现区域，其余部分为黑边。
      */
     class Renderer
     {
     public:
+        /**
+         * @brief 每帧统计（Present() 时保存），包含命令队列和精灵批处理的提交
+         *
+         * 图元计数按调用方请求的数量统计（不论立即模式还是入队），
+         * drawCalls 统计实际发给 SDL 的调用次数。文字由 FontRenderer 单独统计。
+         */
+        struct FrameStats
+        {
+            int drawCalls = 0;         // SDL 绘制调用总数
+            int points = 0;            // 逐像素绘制的点（圆形回退路径）
+            int lines = 0;
+            int rects = 0;             // 实心和空心矩形
+            int textureDraws = 0;      // 纹理/精灵四边形
+            int batches = 0;           // 命令队列和精灵批处理的几何提交次数
+            int stateChanges = 0;      // 命令队列的纹理/混合模式/颜色切换次数
+            int vertices = 0;
+            int texturesCreated = 0;
+            int texturesDestroyed = 0;
+            float presentMs = 0.0f;    // SDL_RenderPresent 耗时：驱动提交 GPU 命令及等待垂直同步
+        };
+
         explicit Renderer(SDL_Renderer* sdlRenderer);
-        ~Renderer() = default;
+        ~Renderer();
 
         // 禁止拷贝
         Renderer(const Renderer&) = delete;
@@ -70,12 +105,143 @@ namespace Match3
          */
         void DrawCircle(int centerX, int centerY, int radius);
 
+        /**
+         * @brief 绘制纹理到目标矩形
+         * @param texture 纹理
+         * @param dest 目标矩形
+         * @param r, g, b 颜色调制
+         * @param a 透明度调制
+         */
+        void DrawTexture(const Texture& texture, const SDL_FRect& dest,
+                         uint8_t r = 255, uint8_t g = 255, uint8_t b = 255, uint8_t a = 255);
+
+        /**
+         * @brief 绘制纹理的一部分（如图集中的字形）到目标矩形
+         * @param texture 纹理
+         * @param source 源矩形
+         * @param dest 目标矩形
+         * @param r, g, b 颜色调制
+         * @param a 透明度调制
+         */
+        void DrawTexture(const Texture& texture, const SDL_FRect& source, const SDL_FRect& dest,
+                         uint8_t r = 255, uint8_t g = 255, uint8_t b = 255, uint8_t a = 255);
+
+        /**
+         * @brief 绘制圆形精灵（按半径缩放，中心对齐）
+         * @param sprite 精灵
+         * @param centerX 中心 X
+         * @param centerY 中心 Y
+         * @param radius 目标半径（对应 sprite.radius）
+         * @param r, g, b 颜色调制
+         * @param a 透明度调制
+         */
+        void DrawSprite(const Sprite& sprite, float centerX, float centerY, float radius,
+                        uint8_t r = 255, uint8_t g = 255, uint8_t b = 255, uint8_t a = 255);
+
+        /**
+         * @brief 获取精灵批处理器（宝石/粒子等大量精灵合并提交）
+         * 会先提交命令队列，保证批处理内容画在已入队内容之上
+         */
+        [[nodiscard]] SpriteBatch& GetSpriteBatch();
+
+        /**
+         * @brief 开始记录命令队列
+         */
+        void BeginQueue();
+
+        /**
+         * @brief 提交队列中的命令（保持记录状态）
+         */
+        void FlushQueue();
+
+        /**
+         * @brief 提交队列并回到立即模式
+         */
+        void EndQueue();
+
+        /**
+         * @brief 设置后续入队命令的图层（数值大的在上层）
+         */
+        void SetLayer(int layer) { m_layer = layer; }
+
+        /**
+         * @brief 是否处于命令队列模式
+         */
+        [[nodiscard]] bool IsQueueing() const { return m_queueing; }
+
+        /**
+         * @brief 启用逻辑分辨率渲染目标，之后的绘制都在 width x height 坐标系内
+         * @return 渲染目标创建失败返回 false（保持直接渲染到窗口）
+         */
+        bool EnableLogicalTarget(int width, int height);
+
+        /**
+         * @brief 设置逻辑画面在窗口中的呈现区域和缩放过滤方式
+         */
+        void SetPresentRect(const SDL_FRect& dest, SDL_ScaleMode scaleMode);
+
+        /**
+         * @brief 是否正在渲染到逻辑分辨率目标
+         */
+        [[nodiscard]] bool HasLogicalTarget() const { return m_logicalTarget != nullptr; }
+
+        /**
+         * @brief 设置呈现前回调（所有绘制已提交、SDL_RenderPresent 之前），例如无头模式读回像素
+         */
+        void SetPresentHook(std::function<void(SDL_Renderer*)> hook) { m_presentHook = std::move(hook); }
+
+        /**
+         * @brief 获取命令队列（用于统计）
+         */
+        [[nodiscard]] const RenderQueue& GetRenderQueue() const { return *m_queue; }
+
+        /**
+         * @brief 获取上一帧的统计
+         */
+        [[nodiscard]] const FrameStats& GetFrameStats() const { return m_lastFrameStats; }
+
+        /**
+         * @brief 设置叠加层回调（调试信息等），Present() 时在所有内容之上以立即模式绘制，
+         * 其绘制计入当帧统计
+         */
+        void SetOverlay(std::function<void(Renderer&)> overlay) { m_overlay = std::move(overlay); }
+
+        /**
+         * @brief 设置资源管理器（用于精灵缓存查询）
+         */
+        void SetResourceManager(ResourceManager* resourceManager) { m_resourceManager = resourceManager; }
+
+        /**
+         * @brief 获取资源管理器，未设置时返回 nullptr
+         */
+        [[nodiscard]] ResourceManager* GetResourceManager() const { return m_resourceManager; }
+
         /**
          * @brief 获取底层 SDL 渲染器（用于高级操作）
          */
         [[nodiscard]] SDL_Renderer* GetSDLRenderer() const { return m_sdlRenderer; }
 
     private:
+        /**
+         * @brief 合并命令队列/精灵批处理的统计，保存本帧并清零
+         */
+        void EndFrameStats();
+
         SDL_Renderer* m_sdlRenderer; // 不拥有所有权
+        ResourceManager* m_resourceManager = nullptr; // 不拥有所有权
+        std::unique_ptr<SpriteBatch> m_spriteBatch;
+        std::unique_ptr<RenderQueue> m_queue;
+        bool m_queueing = false;
+        int m_layer = 0;
+        SDL_Color m_drawColor = {0, 0, 0, 255};
+        std::function<void(SDL_Renderer*)> m_presentHook;
+        std::function<void(Renderer&)> m_overlay;
+        std::unique_ptr<Texture> m_logicalTarget; // 逻辑分辨率离屏目标（可选）
+        SDL_FRect m_presentRect = {0.0f, 0.0f, 0.0f, 0.0f};
+
+        FrameStats m_stats;
+        FrameStats m_lastFrameStats;
+        uint64_t m_texturesCreatedMark = 0;   // 上一帧结束时 Texture 的累计创建数
+        uint64_t m_texturesDestroyedMark = 0;
     };
 } // namespace Match3
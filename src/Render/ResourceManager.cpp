@@ -1,11 +1,139 @@
 #include "ResourceManager.hpp"
+#include "Core/Config.hpp"
 #include "Core/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+#include <nlohmann/json.hpp>
 
 namespace Match3
 {
-    ResourceManager::ResourceManager(SDL_Renderer* renderer)
+    namespace
+    {
+        using json = nlohmann::json;
+
+        constexpr auto GEM_SPRITE_SHEET = "gem_sprites";
+        constexpr auto GEM_SPRITE_PREFIX = "gem_";    // gem_0 ~ gem_<GEM_TYPES-1>
+        constexpr auto PARTICLE_SPRITE = "particle";  // 白色，绘制时按粒子颜色调制
+        constexpr auto ATLAS_PAGE_PREFIX = "atlas:";
+        constexpr int ATLAS_VERSION = 1;              // 与 tools/AtlasPacker 一致
+        constexpr int SUPERSAMPLES = 4; // 每像素 4x4 采样
+
+        /**
+         * @brief 非预乘 RGBA 像素（0~1）
+         */
+        struct Pixel
+        {
+            float r = 0.0f;
+            float g = 0.0f;
+            float b = 0.0f;
+            float a = 0.0f;
+
+            // Porter-Duff over
+            void BlendOver(const float sr, const float sg, const float sb, const float sa)
+            {
+                const float outA = sa + a * (1.0f - sa);
+                if (outA <= 0.0f)
+                {
+                    return;
+                }
+                r = (sr * sa + r * a * (1.0f - sa)) / outA;
+                g = (sg * sa + g * a * (1.0f - sa)) / outA;
+                b = (sb * sa + b * a * (1.0f - sa)) / outA;
+                a = outA;
+            }
+        };
+
+        /**
+         * @brief 计算像素被区域覆盖的比例（超采样）
+         */
+        template <typename InsideFn>
+        float Coverage(const float px, const float py, InsideFn&& inside)
+        {
+            int hits = 0;
+            for (int sy = 0; sy < SUPERSAMPLES; ++sy)
+            {
+                for (int sx = 0; sx < SUPERSAMPLES; ++sx)
+                {
+                    const float x = px + (sx + 0.5f) / SUPERSAMPLES;
+                    const float y = py + (sy + 0.5f) / SUPERSAMPLES;
+                    hits += inside(x, y) ? 1 : 0;
+                }
+            }
+            return static_cast<float>(hits) / (SUPERSAMPLES * SUPERSAMPLES);
+        }
+
+        /**
+         * @brief 在表面的一个格子里光栅化圆形精灵
+         * @param pixelScale 每逻辑像素对应的精灵像素数
+         * @param decorated 是否绘制边框与高光（宝石），否则为纯白圆片（粒子）
+         */
+        void RasterizeCircleSprite(SDL_Surface* surface, const int cellX, const int cellSize, const float radius,
+                                   const float pixelScale, const Config::GemColor& color, const bool decorated)
+        {
+            const float center = cellSize * 0.5f;
+            const float borderWidth = pixelScale; // 1 逻辑像素
+            const float highlightRadius = radius / Config::GEM_HIGHLIGHT_OFFSET_DIVISOR;
+            const float highlightX = center - highlightRadius;
+            const float highlightY = center - highlightRadius;
+
+            auto insideBody = [&](float x, float y)
+            {
+                const float dx = x - center;
+                const float dy = y - center;
+                return dx * dx + dy * dy <= radius * radius;
+            };
+            auto insideBorder = [&](float x, float y)
+            {
+                const float d = std::hypot(x - center, y - center);
+                return std::abs(d - radius) <= borderWidth * 0.5f;
+            };
+            auto insideHighlight = [&](float x, float y)
+            {
+                const float dx = x - highlightX;
+                const float dy = y - highlightY;
+                return dx * dx + dy * dy <= highlightRadius * highlightRadius;
+            };
+
+            const auto& border = Config::GEM_BORDER_COLOR;
+            const auto& highlight = Config::GEM_HIGHLIGHT_COLOR;
+
+            auto* pixels = static_cast<uint8_t*>(surface->pixels);
+            for (int y = 0; y < cellSize; ++y)
+            {
+                uint8_t* row = pixels + y * surface->pitch + cellX * 4;
+                for (int x = 0; x < cellSize; ++x)
+                {
+                    const float fx = static_cast<float>(x);
+                    const float fy = static_cast<float>(y);
+
+                    Pixel pixel;
+                    pixel.BlendOver(color.r / 255.0f, color.g / 255.0f, color.b / 255.0f,
+                                    color.a / 255.0f * Coverage(fx, fy, insideBody));
+
+                    if (decorated)
+                    {
+                        pixel.BlendOver(border.r / 255.0f, border.g / 255.0f, border.b / 255.0f,
+                                        border.a / 255.0f * Coverage(fx, fy, insideBorder));
+                        pixel.BlendOver(highlight.r / 255.0f, highlight.g / 255.0f, highlight.b / 255.0f,
+                                        highlight.a / 255.0f * Coverage(fx, fy, insideHighlight));
+                    }
+
+                    // SDL_PIXELFORMAT_RGBA32：内存中依次为 R G B A
+                    uint8_t* out = row + x * 4;
+                    out[0] = static_cast<uint8_t>(std::lround(pixel.r * 255.0f));
+                    out[1] = static_cast<uint8_t>(std::lround(pixel.g * 255.0f));
+                    out[2] = static_cast<uint8_t>(std::lround(pixel.b * 255.0f));
+                    out[3] = static_cast<uint8_t>(std::lround(pixel.a * 255.0f));
+                }
+            }
+        }
+    }
+
+    ResourceManager::ResourceManager(SDL_Renderer* renderer, const size_t budgetBytes)
         : m_renderer(renderer)
+          , m_budgetBytes(budgetBytes)
     {
+        InternGemSprites();
     }
 
     bool ResourceManager::CreateColorTexture(const std::string& name, const int width, const int height,
@@ -19,36 +147,442 @@ namespace Match3
             return true;
         }
 
-        auto texture = std::make_unique<Texture>();
-        if (!texture->CreateFromColor(m_renderer, width, height, r, g, b, a))
+        const bool created = AddTexture(name, [=](SDL_Renderer* renderer, Texture& texture)
+        {
+            return texture.CreateFromColor(renderer, width, height, r, g, b, a);
+        });
+        if (!created)
         {
             LOG_ERROR("Failed to create color texture '{}'", name);
             return false;
         }
 
-        m_textures[name] = std::move(texture);
         LOG_DEBUG("Created color texture '{}' ({}x{})", name, width, height);
         return true;
     }
 
-    Texture* ResourceManager::GetTexture(const std::string& name)
+    bool ResourceManager::LoadTexture(const std::string& name, const std::string& path)
+    {
+        return AddTexture(name, [path](SDL_Renderer* renderer, Texture& texture)
+        {
+            SDL_Surface* surface = SDL_LoadBMP(path.c_str());
+            if (!surface)
+            {
+                LOG_ERROR("Failed to load texture file {}: {}", path, SDL_GetError());
+                return false;
+            }
+            const bool created = texture.CreateFromSurface(renderer, surface);
+            SDL_DestroySurface(surface);
+            return created;
+        });
+    }
+
+    bool ResourceManager::AddTexture(const std::string& name, TextureLoader loader)
+    {
+        if (!loader)
+        {
+            LOG_ERROR("Texture '{}' has no loader", name);
+            return false;
+        }
+
+        TextureEntry* entry = Register(name, std::move(loader));
+        return Load(*entry);
+    }
+
+    bool ResourceManager::CreateGemSprites(const int radius, const int oversample)
+    {
+        SDL_Surface* surface = RasterizeGemSprites(radius, oversample);
+        if (!surface)
+        {
+            return false;
+        }
+
+        const bool uploaded = UploadGemSprites(surface, radius, oversample);
+        SDL_DestroySurface(surface);
+        return uploaded;
+    }
+
+    SDL_Surface* ResourceManager::RasterizeGemSprites(const int radius, const int oversample)
+    {
+        if (radius <= 0 || oversample <= 0)
+        {
+            LOG_ERROR("Invalid gem sprite parameters (radius {}, oversample {})", radius, oversample);
+            return nullptr;
+        }
+
+        // 每个格子：主体 + 边框 + 抗锯齿留白
+        const float spriteRadius = static_cast<float>(radius * oversample);
+        const int cellSize = (radius + 2) * 2 * oversample;
+        const int cellCount = Config::GEM_TYPES + 1; // 最后一格为粒子
+
+        SDL_Surface* surface = SDL_CreateSurface(cellSize * cellCount, cellSize, SDL_PIXELFORMAT_RGBA32);
+        if (!surface)
+        {
+            LOG_ERROR("Failed to create gem sprite surface: {}", SDL_GetError());
+            return nullptr;
+        }
+
+        for (int i = 0; i < Config::GEM_TYPES; ++i)
+        {
+            RasterizeCircleSprite(surface, i * cellSize, cellSize, spriteRadius, static_cast<float>(oversample),
+                                  Config::GEM_COLORS[i], true);
+        }
+        RasterizeCircleSprite(surface, Config::GEM_TYPES * cellSize, cellSize, spriteRadius,
+                              static_cast<float>(oversample), {255, 255, 255, 255}, false);
+        return surface;
+    }
+
+    bool ResourceManager::UploadGemSprites(SDL_Surface* surface, const int radius, const int oversample)
+    {
+        if (!surface)
+        {
+            return false;
+        }
+
+        // 图集已提供全部宝石与粒子精灵时不再上传程序生成的精灵表
+        const auto fromAtlas = [this](const SpriteHandle sprite) { return m_sprites[sprite.index].fromAtlas; };
+        if (std::ranges::all_of(m_gemSprites, fromAtlas) && fromAtlas(m_particleSprite))
+        {
+            LOG_INFO("Gem sprites provided by the texture atlas, skipping the generated sheet");
+            return true;
+        }
+
+        const float spriteRadius = static_cast<float>(radius * oversample);
+        const int cellSize = (radius + 2) * 2 * oversample;
+        const int cellCount = Config::GEM_TYPES + 1;
+
+        // 首次上传使用工作线程的光栅化结果；淘汰后在渲染线程重新光栅化
+        TextureEntry* entry = Register(GEM_SPRITE_SHEET, [radius, oversample](SDL_Renderer* renderer, Texture& texture)
+        {
+            SDL_Surface* rasterized = RasterizeGemSprites(radius, oversample);
+            const bool created = rasterized && texture.CreateFromSurface(renderer, rasterized);
+            SDL_DestroySurface(rasterized);
+            return created;
+        });
+
+        if (!entry->texture.CreateFromSurface(m_renderer, surface))
+        {
+            LOG_ERROR("Failed to create gem sprite texture");
+            return false;
+        }
+        m_residentBytes += entry->bytes = static_cast<size_t>(surface->w) * surface->h * 4;
+        entry->lastUsedFrame = m_frame;
+        EnforceBudget();
+
+        // 图集里已有的同名精灵保持不变
+        auto setCell = [&](const SpriteHandle handle, const int index)
+        {
+            SpriteEntry& sprite = m_sprites[handle.index];
+            if (sprite.fromAtlas)
+            {
+                return;
+            }
+            sprite.page = entry;
+            sprite.source = {static_cast<float>(index * cellSize), 0.0f,
+                             static_cast<float>(cellSize), static_cast<float>(cellSize)};
+            sprite.radius = spriteRadius;
+        };
+
+        for (int i = 0; i < Config::GEM_TYPES; ++i)
+        {
+            setCell(m_gemSprites[i], i);
+        }
+        setCell(m_particleSprite, Config::GEM_TYPES);
+
+        LOG_INFO("Created gem sprite sheet ({}x{}, {} sprites)", entry->texture.GetWidth(), entry->texture.GetHeight(),
+                 cellCount);
+        return true;
+    }
+
+    bool ResourceManager::LoadAtlas(const std::string& metadataPath, const std::vector<uint8_t>& metadata)
+    {
+        const size_t slash = metadataPath.find_last_of("/\\");
+        const std::string directory = slash == std::string::npos ? std::string() : metadataPath.substr(0, slash + 1);
+
+        try
+        {
+            const json atlas = json::parse(metadata.begin(), metadata.end());
+            if (atlas.value("version", 0) != ATLAS_VERSION)
+            {
+                LOG_ERROR("Unsupported texture atlas version in {}", metadataPath);
+                return false;
+            }
+
+            struct Page
+            {
+                TextureEntry* entry;
+                int width;
+                int height;
+            };
+            std::vector<Page> pages;
+            bool loaded = true;
+            for (const auto& page : atlas.at("pages"))
+            {
+                const auto file = page.at("file").get<std::string>();
+                const std::string name = ATLAS_PAGE_PREFIX + file;
+                loaded = LoadTexture(name, directory + file) && loaded;
+                pages.push_back({m_textures[FindTexture(name).index].get(),
+                                 page.at("width").get<int>(), page.at("height").get<int>()});
+            }
+
+            size_t spriteCount = 0;
+            for (const auto& sprite : atlas.at("sprites"))
+            {
+                const auto name = sprite.at("name").get<std::string>();
+                const auto pageIndex = sprite.at("page").get<size_t>();
+                const int x = sprite.at("x").get<int>();
+                const int y = sprite.at("y").get<int>();
+                const int w = sprite.at("w").get<int>();
+                const int h = sprite.at("h").get<int>();
+                if (pageIndex >= pages.size() || x < 0 || y < 0 || w <= 0 || h <= 0 ||
+                    x + w > pages[pageIndex].width || y + h > pages[pageIndex].height)
+                {
+                    LOG_WARN("Atlas sprite '{}' lies outside its page, skipped", name);
+                    continue;
+                }
+
+                SpriteEntry& entry = m_sprites[InternSprite(name).index];
+                entry.page = pages[pageIndex].entry;
+                entry.source = {static_cast<float>(x), static_cast<float>(y), static_cast<float>(w),
+                                static_cast<float>(h)};
+                entry.radius = sprite.value("radius", std::min(w, h) * 0.5f);
+                entry.fromAtlas = true;
+                ++spriteCount;
+            }
+
+            LOG_INFO("Loaded texture atlas {} ({} page(s), {} sprite(s))", metadataPath, pages.size(), spriteCount);
+            return loaded;
+        }
+        catch (const json::exception& e)
+        {
+            LOG_ERROR("Invalid texture atlas {}: {}", metadataPath, e.what());
+            return false;
+        }
+    }
+
+    SpriteHandle ResourceManager::FindSprite(const std::string& name) const
+    {
+        const auto it = m_spriteIds.find(name);
+        return it != m_spriteIds.end() ? it->second : SpriteHandle{};
+    }
+
+    Sprite ResourceManager::GetSprite(const SpriteHandle sprite)
     {
-        const auto it = m_textures.find(name);
-        if (it != m_textures.end())
+        if (sprite.index >= m_sprites.size())
         {
-            return it->second.get();
+            return {};
+        }
+
+        const SpriteEntry& entry = m_sprites[sprite.index];
+        if (!entry.page || !Touch(*entry.page))
+        {
+            return {};
+        }
+        return {&entry.page->texture, entry.source, entry.radius};
+    }
+
+    Sprite ResourceManager::GetGemSprite(const int type)
+    {
+        if (type < 0 || type >= static_cast<int>(m_gemSprites.size()))
+        {
+            return {};
+        }
+        return GetSprite(m_gemSprites[type]);
+    }
+
+    Sprite ResourceManager::GetParticleSprite()
+    {
+        return GetSprite(m_particleSprite);
+    }
+
+    SpriteHandle ResourceManager::InternSprite(const std::string& name)
+    {
+        const auto [it, inserted] =
+            m_spriteIds.emplace(name, SpriteHandle{static_cast<uint32_t>(m_sprites.size())});
+        if (inserted)
+        {
+            m_sprites.emplace_back();
+        }
+        return it->second;
+    }
+
+    void ResourceManager::InternGemSprites()
+    {
+        m_gemSprites.clear();
+        for (int i = 0; i < Config::GEM_TYPES; ++i)
+        {
+            m_gemSprites.push_back(InternSprite(GEM_SPRITE_PREFIX + std::to_string(i)));
+        }
+        m_particleSprite = InternSprite(PARTICLE_SPRITE);
+    }
+
+    TextureHandle ResourceManager::FindTexture(const std::string& name) const
+    {
+        const auto it = m_textureIds.find(name);
+        return it != m_textureIds.end() ? it->second : TextureHandle{};
+    }
+
+    Texture* ResourceManager::GetTexture(const TextureHandle texture)
+    {
+        if (texture.index < m_textures.size() && Touch(*m_textures[texture.index]))
+        {
+            return &m_textures[texture.index]->texture;
         }
         return nullptr;
     }
 
+    Texture* ResourceManager::GetTexture(const std::string& name)
+    {
+        return GetTexture(FindTexture(name));
+    }
+
     bool ResourceManager::HasTexture(const std::string& name) const
     {
-        return m_textures.contains(name);
+        return m_textureIds.contains(name);
+    }
+
+    void ResourceManager::BeginFrame()
+    {
+        ++m_frame;
+        if (m_residentBytes > m_budgetBytes)
+        {
+            EnforceBudget();
+        }
+    }
+
+    void ResourceManager::Purge(const bool includeInUse)
+    {
+        const size_t before = m_residentBytes;
+        for (auto& entry : m_textures)
+        {
+            if (entry->texture.IsValid() && entry->loader && (includeInUse || entry->lastUsedFrame < m_frame))
+            {
+                Evict(*entry);
+            }
+        }
+        LOG_INFO("Purged textures: {} KB -> {} KB resident", before / 1024, m_residentBytes / 1024);
+    }
+
+    void ResourceManager::SetBudget(const size_t budgetBytes)
+    {
+        m_budgetBytes = budgetBytes;
+        EnforceBudget();
+    }
+
+    ResourceManager::TextureEntry* ResourceManager::Register(const std::string& name, TextureLoader loader)
+    {
+        const auto [it, inserted] =
+            m_textureIds.emplace(name, TextureHandle{static_cast<uint32_t>(m_textures.size())});
+        if (inserted)
+        {
+            m_textures.push_back(std::make_unique<TextureEntry>());
+            m_textures.back()->name = name;
+        }
+
+        auto& slot = m_textures[it->second.index];
+        if (slot->texture.IsValid())
+        {
+            // 替换已有纹理：同一对象重新加载，持有指针的精灵保持有效
+            Evict(*slot);
+        }
+        slot->loader = std::move(loader);
+        slot->failedFrame = UINT64_MAX;
+        return slot.get();
+    }
+
+    bool ResourceManager::Touch(TextureEntry& entry)
+    {
+        entry.lastUsedFrame = m_frame;
+        if (entry.texture.IsValid())
+        {
+            return true;
+        }
+
+        // 重新加载失败的纹理每帧最多重试一次
+        if (!entry.loader || entry.failedFrame == m_frame)
+        {
+            return false;
+        }
+        LOG_DEBUG("Reloading evicted texture '{}'", entry.name);
+        return Load(entry);
+    }
+
+    bool ResourceManager::Load(TextureEntry& entry)
+    {
+        if (!entry.loader(m_renderer, entry.texture) || !entry.texture.IsValid())
+        {
+            entry.failedFrame = m_frame;
+            LOG_ERROR("Failed to load texture '{}'", entry.name);
+            return false;
+        }
+
+        // 估算：按 4 字节/像素计
+        entry.bytes = static_cast<size_t>(entry.texture.GetWidth()) * entry.texture.GetHeight() * 4;
+        entry.lastUsedFrame = m_frame;
+        entry.failedFrame = UINT64_MAX;
+        m_residentBytes += entry.bytes;
+        EnforceBudget();
+        return true;
+    }
+
+    void ResourceManager::Evict(TextureEntry& entry)
+    {
+        entry.texture.Free();
+        m_residentBytes -= entry.bytes;
+        entry.bytes = 0;
+    }
+
+    void ResourceManager::EnforceBudget()
+    {
+        if (m_residentBytes <= m_budgetBytes)
+        {
+            m_overBudget = false;
+            return;
+        }
+
+        // 候选：可重新加载、且本帧未使用的常驻纹理，最久未用的先淘汰
+        std::vector<TextureEntry*> candidates;
+        for (auto& entry : m_textures)
+        {
+            if (entry->texture.IsValid() && entry->loader && entry->lastUsedFrame < m_frame)
+            {
+                candidates.push_back(entry.get());
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const TextureEntry* a, const TextureEntry* b)
+        {
+            return a->lastUsedFrame < b->lastUsedFrame;
+        });
+
+        for (TextureEntry* entry : candidates)
+        {
+            if (m_residentBytes <= m_budgetBytes)
+            {
+                break;
+            }
+            LOG_DEBUG("Evicting texture '{}' ({} KB, last used {} frame(s) ago)", entry->name, entry->bytes / 1024,
+                      m_frame - entry->lastUsedFrame);
+            Evict(*entry);
+        }
+
+        // 本帧在用的纹理本身就超出预算：只在刚超出时警告一次
+        const bool overBudget = m_residentBytes > m_budgetBytes;
+        if (overBudget && !m_overBudget)
+        {
+            LOG_WARN("Textures in use this frame exceed the budget ({} KB > {} KB)", m_residentBytes / 1024,
+                     m_budgetBytes / 1024);
+        }
+        m_overBudget = overBudget;
     }
 
     void ResourceManager::Clear()
     {
+        m_sprites.clear();
+        m_spriteIds.clear();
+        InternGemSprites();
         m_textures.clear();
+        m_textureIds.clear();
+        m_residentBytes = 0;
         LOG_INFO("All resources cleared");
     }
 } // namespace Match3
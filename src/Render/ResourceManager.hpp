@@ -1,20 +1,52 @@
 #pragma once
 
 #include "Texture.hpp"
+#include "Sprite.hpp"
+#include "Utils/Handle.hpp"
 #include <SDL3/SDL.h>
 #include <ankerl/unordered_dense.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Match3
 {
+    /**
+     * @brief 纹理句柄，加载后用 ResourceManager::FindTexture() 解析一次
+     */
+    using TextureHandle = Handle<struct TextureTag>;
+
+    /**
+     * @brief 具名精灵句柄，用 ResourceManager::FindSprite() 解析一次
+     */
+    using SpriteHandle = Handle<struct SpriteTag>;
+
     /**
      * @brief 资源管理器 - 管理游戏中的所有资源
+     *
+     * 每个纹理记录显存占用、最近使用帧和重新加载方式。常驻总量超过预算时，
+     * 按最近最少使用淘汰本帧未用到的纹理；被淘汰的纹理在下次 GetTexture()/
+     * GetGemSprite() 时从来源透明地重新加载。纹理对象地址不变，淘汰只释放内容。
+     *
+     * 条目按注册顺序存放在数组中，TextureHandle 即下标；按名字查找只在加载时
+     * 解析句柄或供工具使用，每帧绘制应持有句柄。
+     *
+     * 精灵是某张纹理上的具名子区域，来自预渲染的宝石精灵表或构建时打包的
+     * 纹理图集（tools/AtlasPacker）。图集中名为 gem_<类型> 和 particle 的
+     * 精灵会替换程序生成的宝石/粒子，同一页上的精灵可以合并为一个批次绘制。
      */
     class ResourceManager
     {
     public:
-        explicit ResourceManager(SDL_Renderer* renderer);
+        /**
+         * @brief 把纹理内容（重新）创建到给定纹理对象中
+         */
+        using TextureLoader = std::function<bool(SDL_Renderer*, Texture&)>;
+
+        explicit ResourceManager(SDL_Renderer* renderer, size_t budgetBytes = SIZE_MAX);
         ~ResourceManager() = default;
 
         // 禁止拷贝
@@ -36,24 +68,200 @@ namespace Match3
                                 uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255);
 
         /**
-         * @brief 获取纹理
+         * @brief 从 BMP 文件加载纹理（如 resources/textures 下的图片）
          * @param name 纹理名称
-         * @return 纹理指针，不存在则返回 nullptr
+         * @param path 文件路径，淘汰后从这里重新加载
+         * @return 成功返回 true
+         */
+        bool LoadTexture(const std::string& name, const std::string& path);
+
+        /**
+         * @brief 用自定义加载函数创建纹理，淘汰后用同一函数重新加载
+         * @param name 纹理名称
+         * @param loader 加载函数
+         * @return 成功返回 true
+         */
+        bool AddTexture(const std::string& name, TextureLoader loader);
+
+        /**
+         * @brief 预渲染宝石精灵表
+         *
+         * 在 CPU 上光栅化每种宝石（抗锯齿主体 + 边框 + 高光），以及一个白色粒子圆片，
+         * 打包进同一张纹理。绘制时只需缩放贴图并做颜色/透明度调制。
+         *
+         * @param radius 宝石主体半径（逻辑像素）
+         * @param oversample 超采样倍数（放大动画时保持清晰）
+         * @return 成功返回 true
+         */
+        bool CreateGemSprites(int radius, int oversample = 2);
+
+        /**
+         * @brief 光栅化宝石精灵表（纯 CPU，不访问渲染器，可在工作线程调用）
+         * @return 精灵表表面，由调用方释放；失败返回 nullptr
+         */
+        static SDL_Surface* RasterizeGemSprites(int radius, int oversample = 2);
+
+        /**
+         * @brief 上传精灵表并建立精灵（渲染线程调用），surface 由调用方释放
+         * @param surface RasterizeGemSprites() 的结果
+         * @param radius 与光栅化时相同
+         * @param oversample 与光栅化时相同
+         * @return 成功返回 true
+         */
+        bool UploadGemSprites(SDL_Surface* surface, int radius, int oversample = 2);
+
+        /**
+         * @brief 加载纹理图集：注册每一页并登记其中的精灵（渲染线程调用）
+         *
+         * 页面纹理以 "atlas:<文件名>" 注册，可被淘汰并按文件重新加载。
+         * @param metadataPath 图集描述文件路径，页面文件相对它所在的目录
+         * @param metadata 描述文件内容（AtlasPacker 生成的 JSON）
+         * @return 描述有效且所有页面加载成功返回 true
+         */
+        bool LoadAtlas(const std::string& metadataPath, const std::vector<uint8_t>& metadata);
+
+        /**
+         * @brief 把精灵名称解析为句柄（加载时调用一次）
+         * @return 未登记时返回无效句柄
+         */
+        [[nodiscard]] SpriteHandle FindSprite(const std::string& name) const;
+
+        /**
+         * @brief 获取精灵（所在页面记为本帧使用，已淘汰则重新加载）
+         * @return 句柄无效、尚未加载或重新加载失败时返回无效精灵
+         */
+        [[nodiscard]] Sprite GetSprite(SpriteHandle sprite);
+
+        /**
+         * @brief 获取宝石精灵
+         * @param type 宝石类型索引（0 ~ GEM_TYPES-1）
+         * @return 未创建或越界时返回无效精灵
+         */
+        [[nodiscard]] Sprite GetGemSprite(int type);
+
+        /**
+         * @brief 获取白色粒子精灵（通过颜色调制着色）
+         */
+        [[nodiscard]] Sprite GetParticleSprite();
+
+        /**
+         * @brief 把纹理名称解析为句柄（加载时调用一次，不要每帧调用）
+         * @return 未注册时返回无效句柄；句柄在 Clear() 之前一直有效
+         */
+        [[nodiscard]] TextureHandle FindTexture(const std::string& name) const;
+
+        /**
+         * @brief 获取纹理（记为本帧使用，已淘汰则重新加载）
+         *
+         * 返回的指针一直有效，但内容可能在之后的帧被淘汰，绘制前应重新获取。
+         * @param texture 纹理句柄
+         * @return 纹理指针，句柄无效或重新加载失败则返回 nullptr
+         */
+        Texture* GetTexture(TextureHandle texture);
+
+        /**
+         * @brief 按名字获取纹理（每次都要查找名字，供工具和一次性调用使用）
          */
         Texture* GetTexture(const std::string& name);
 
         /**
-         * @brief 检查纹理是否存在
+         * @brief 检查纹理是否存在（无论是否常驻）
          */
         [[nodiscard]] bool HasTexture(const std::string& name) const;
 
+        /**
+         * @brief 开始新的一帧：推进 LRU 时钟，并把常驻量压回预算内
+         */
+        void BeginFrame();
+
+        /**
+         * @brief 释放纹理内容，之后使用时重新加载
+         * @param includeInUse false 时保留本帧用到的纹理（低内存）；
+         *        true 时全部释放（设备丢失，内容已失效）
+         */
+        void Purge(bool includeInUse);
+
+        /**
+         * @brief 设置纹理内存预算（字节），立即执行淘汰
+         */
+        void SetBudget(size_t budgetBytes);
+
+        [[nodiscard]] size_t GetBudget() const { return m_budgetBytes; }
+        [[nodiscard]] size_t GetResidentBytes() const { return m_residentBytes; }
+        [[nodiscard]] size_t GetTextureCount() const { return m_textures.size(); }
+
         /**
          * @brief 清空所有资源
          */
         void Clear();
 
     private:
+        struct TextureEntry
+        {
+            std::string name;
+            Texture texture;          // 地址稳定，精灵持有其指针
+            TextureLoader loader;     // 为空时不可重新加载，也不会被淘汰
+            size_t bytes = 0;         // 常驻时的估算显存占用
+            uint64_t lastUsedFrame = 0;
+            uint64_t failedFrame = UINT64_MAX; // 最近一次重新加载失败的帧，本帧不再重试
+        };
+
+        struct SpriteEntry
+        {
+            TextureEntry* page = nullptr; // 为空表示名称已登记但还没有内容
+            SDL_FRect source = {0.0f, 0.0f, 0.0f, 0.0f};
+            float radius = 0.0f;
+            bool fromAtlas = false; // 图集精灵不会被程序生成的精灵覆盖
+        };
+
+        /**
+         * @brief 登记精灵名称（已存在则返回原句柄）
+         */
+        SpriteHandle InternSprite(const std::string& name);
+
+        /**
+         * @brief 登记宝石与粒子精灵的名称，句柄在 Clear() 之前保持不变
+         */
+        void InternGemSprites();
+
+        /**
+         * @brief 创建条目并首次加载
+         */
+        TextureEntry* Register(const std::string& name, TextureLoader loader);
+
+        /**
+         * @brief 标记本帧使用，未常驻时重新加载
+         * @return 纹理是否可用
+         */
+        bool Touch(TextureEntry& entry);
+
+        /**
+         * @brief 加载条目内容并计入常驻量
+         */
+        bool Load(TextureEntry& entry);
+
+        /**
+         * @brief 释放条目内容
+         */
+        void Evict(TextureEntry& entry);
+
+        /**
+         * @brief 按 LRU 淘汰本帧未用到的纹理，直到不超过预算
+         */
+        void EnforceBudget();
+
         SDL_Renderer* m_renderer; // 不拥有所有权
-        ankerl::unordered_dense::map<std::string, std::unique_ptr<Texture>> m_textures;
+        std::vector<std::unique_ptr<TextureEntry>> m_textures;                  // 按 TextureHandle 下标
+        ankerl::unordered_dense::map<std::string, TextureHandle> m_textureIds; // 仅加载和工具使用
+        size_t m_budgetBytes;
+        size_t m_residentBytes = 0;
+        uint64_t m_frame = 1;
+        bool m_overBudget = false;
+
+        // 具名精灵（纹理由 m_textures 持有）
+        std::vector<SpriteEntry> m_sprites;                                   // 按 SpriteHandle 下标
+        ankerl::unordered_dense::map<std::string, SpriteHandle> m_spriteIds; // 仅加载和工具使用
+        std::vector<SpriteHandle> m_gemSprites;                               // 按宝石类型
+        SpriteHandle m_particleSprite;
     };
 } // namespace Match3
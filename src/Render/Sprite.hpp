@@ -0,0 +1,23 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+namespace Match3
+{
+    class Texture;
+
+    /**
+     * @brief 精灵 - 纹理上的一块子区域
+     *
+     * radius 为圆形精灵主体在源纹理中的半径（像素），
+     * 绘制时按目标半径缩放，外圈留白（边框、抗锯齿）随之等比缩放。
+     */
+    struct Sprite
+    {
+        Texture* texture = nullptr;
+        SDL_FRect source = {0.0f, 0.0f, 0.0f, 0.0f};
+        float radius = 0.0f;
+
+        [[nodiscard]] bool IsValid() const { return texture != nullptr; }
+    };
+} // namespace Match3
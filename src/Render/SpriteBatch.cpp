@@ -0,0 +1,170 @@
+#include "SpriteBatch.hpp"
+#include "Texture.hpp"
+#include "Core/Logger.hpp"
+#include <cmath>
+
+namespace Match3
+{
+    SpriteBatch::SpriteBatch(SDL_Renderer* renderer)
+        : m_renderer(renderer)
+    {
+        // 足够容纳 64 颗宝石 + 粒子，避免前几帧扩容
+        m_vertices.reserve(256 * 4);
+        m_indices.reserve(256 * 6);
+    }
+
+    void SpriteBatch::Begin()
+    {
+        m_vertices.clear();
+        m_indices.clear();
+        m_texture = nullptr;
+    }
+
+    void SpriteBatch::Draw(const Sprite& sprite, const float centerX, const float centerY, const float radius,
+                           const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a,
+                           const SDL_BlendMode blendMode)
+    {
+        if (!sprite.IsValid() || sprite.radius <= 0.0f || radius <= 0.0f)
+        {
+            return;
+        }
+
+        const float scale = radius / sprite.radius;
+        const float width = sprite.source.w * scale;
+        const float height = sprite.source.h * scale;
+        Draw(sprite, {centerX - width * 0.5f, centerY - height * 0.5f, width, height}, r, g, b, a, blendMode);
+    }
+
+    void SpriteBatch::DrawRotated(const Sprite& sprite, const float centerX, const float centerY, const float radius,
+                                  const float rotation,
+                                  const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a,
+                                  const SDL_BlendMode blendMode)
+    {
+        if (rotation == 0.0f)
+        {
+            Draw(sprite, centerX, centerY, radius, r, g, b, a, blendMode);
+            return;
+        }
+
+        if (!sprite.IsValid() || sprite.radius <= 0.0f || radius <= 0.0f)
+        {
+            return;
+        }
+
+        // 半宽/半高向量旋转后加到中心，得到四个角
+        const float scale = radius / sprite.radius;
+        const float halfWidth = sprite.source.w * scale * 0.5f;
+        const float halfHeight = sprite.source.h * scale * 0.5f;
+        const float cosine = std::cos(rotation);
+        const float sine = std::sin(rotation);
+
+        auto corner = [&](const float x, const float y)
+        {
+            return SDL_FPoint{centerX + x * cosine - y * sine, centerY + x * sine + y * cosine};
+        };
+        const SDL_FPoint corners[4] = {
+            corner(-halfWidth, -halfHeight), corner(halfWidth, -halfHeight),
+            corner(halfWidth, halfHeight), corner(-halfWidth, halfHeight)
+        };
+        AddQuad(sprite, corners, r, g, b, a, blendMode);
+    }
+
+    void SpriteBatch::Draw(const Sprite& sprite, const SDL_FRect& dest,
+                           const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a,
+                           const SDL_BlendMode blendMode)
+    {
+        const SDL_FPoint corners[4] = {
+            {dest.x, dest.y}, {dest.x + dest.w, dest.y},
+            {dest.x + dest.w, dest.y + dest.h}, {dest.x, dest.y + dest.h}
+        };
+        AddQuad(sprite, corners, r, g, b, a, blendMode);
+    }
+
+    void SpriteBatch::AddQuad(const Sprite& sprite, const SDL_FPoint (&corners)[4],
+                              const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a,
+                              const SDL_BlendMode blendMode)
+    {
+        if (!sprite.IsValid() || a == 0)
+        {
+            return;
+        }
+
+        SDL_Texture* texture = sprite.texture->GetSDLTexture();
+        if (!texture)
+        {
+            return;
+        }
+
+        // 状态变化时先提交上一批
+        if (texture != m_texture || blendMode != m_blendMode)
+        {
+            Flush();
+            m_texture = texture;
+            m_blendMode = blendMode;
+        }
+
+        // 纹理坐标归一化
+        const float invWidth = 1.0f / static_cast<float>(sprite.texture->GetWidth());
+        const float invHeight = 1.0f / static_cast<float>(sprite.texture->GetHeight());
+        const float u0 = sprite.source.x * invWidth;
+        const float v0 = sprite.source.y * invHeight;
+        const float u1 = (sprite.source.x + sprite.source.w) * invWidth;
+        const float v1 = (sprite.source.y + sprite.source.h) * invHeight;
+
+        const SDL_FColor color = {r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f};
+
+        const int base = static_cast<int>(m_vertices.size());
+        m_vertices.push_back({corners[0], color, {u0, v0}});
+        m_vertices.push_back({corners[1], color, {u1, v0}});
+        m_vertices.push_back({corners[2], color, {u1, v1}});
+        m_vertices.push_back({corners[3], color, {u0, v1}});
+
+        m_indices.push_back(base + 0);
+        m_indices.push_back(base + 1);
+        m_indices.push_back(base + 2);
+        m_indices.push_back(base + 0);
+        m_indices.push_back(base + 2);
+        m_indices.push_back(base + 3);
+
+        ++m_stats.sprites;
+    }
+
+    void SpriteBatch::Flush()
+    {
+        if (m_indices.empty() || !m_texture)
+        {
+            return;
+        }
+
+        // 调制由顶点颜色完成，纹理自身的调制需要复位
+        SDL_SetTextureColorMod(m_texture, 255, 255, 255);
+        SDL_SetTextureAlphaMod(m_texture, 255);
+        SDL_SetTextureBlendMode(m_texture, m_blendMode);
+
+        if (!SDL_RenderGeometry(m_renderer, m_texture,
+                                m_vertices.data(), static_cast<int>(m_vertices.size()),
+                                m_indices.data(), static_cast<int>(m_indices.size())))
+        {
+            LOG_ERROR("SpriteBatch: SDL_RenderGeometry failed: {}", SDL_GetError());
+        }
+
+        ++m_stats.drawCalls;
+        m_stats.vertices += static_cast<int>(m_vertices.size());
+        m_stats.indices += static_cast<int>(m_indices.size());
+
+        m_vertices.clear();
+        m_indices.clear();
+    }
+
+    void SpriteBatch::End()
+    {
+        Flush();
+        m_texture = nullptr;
+    }
+
+    void SpriteBatch::EndFrame()
+    {
+        m_lastFrameStats = m_stats;
+        m_stats = {};
+    }
+} // namespace Match3
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Sprite.hpp"
+#include <SDL3/SDL.h>
+#include <vector>
+
+namespace Match3
+{
+    /**
+     * @brief 精灵批处理器 - 将同一纹理/混合状态的精灵合并为一次 SDL_RenderGeometry
+     *
+     * 每个精灵生成 4 个顶点和 6 个索引，颜色/透明度调制写入顶点颜色。
+     * 纹理或混合模式变化时自动提交上一批。顶点/索引缓冲区在帧间复用。
+     *
+     * 用法：Begin() → 多次 Draw() → End()。
+     * 在批次中间需要立即模式绘制时先调用 Flush()，保证绘制顺序。
+     */
+    class SpriteBatch
+    {
+    public:
+        /**
+         * @brief 每帧统计
+         */
+        struct Stats
+        {
+            int drawCalls = 0; // SDL_RenderGeometry 调用次数
+            int sprites = 0;   // 提交的精灵数量
+            int vertices = 0;  // 提交的顶点数量
+            int indices = 0;   // 提交的索引数量
+        };
+
+        explicit SpriteBatch(SDL_Renderer* renderer);
+
+        // 禁止拷贝
+        SpriteBatch(const SpriteBatch&) = delete;
+        SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+        /**
+         * @brief 开始一批绘制
+         */
+        void Begin();
+
+        /**
+         * @brief 添加圆形精灵（按半径缩放，中心对齐，与 Renderer::DrawSprite 一致）
+         */
+        void Draw(const Sprite& sprite, float centerX, float centerY, float radius,
+                  uint8_t r = 255, uint8_t g = 255, uint8_t b = 255, uint8_t a = 255,
+                  SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND);
+
+        /**
+         * @brief 添加绕中心旋转的圆形精灵（顶点在 CPU 上旋转，与其他精灵同批提交）
+         * @param rotation 顺时针旋转角度（弧度，屏幕坐标 y 轴向下）
+         */
+        void DrawRotated(const Sprite& sprite, float centerX, float centerY, float radius, float rotation,
+                         uint8_t r = 255, uint8_t g = 255, uint8_t b = 255, uint8_t a = 255,
+                         SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND);
+
+        /**
+         * @brief 添加精灵到任意目标矩形
+         */
+        void Draw(const Sprite& sprite, const SDL_FRect& dest,
+                  uint8_t r = 255, uint8_t g = 255, uint8_t b = 255, uint8_t a = 255,
+                  SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND);
+
+        /**
+         * @brief 提交当前累积的几何
+         */
+        void Flush();
+
+        /**
+         * @brief 结束一批绘制（提交剩余几何）
+         */
+        void End();
+
+        /**
+         * @brief 结束一帧：保存本帧统计并清零（由 Renderer::Present 调用）
+         */
+        void EndFrame();
+
+        /**
+         * @brief 获取上一帧的统计
+         */
+        [[nodiscard]] const Stats& GetFrameStats() const { return m_lastFrameStats; }
+
+    private:
+        /**
+         * @brief 追加一个四边形，corners 依次为源区域左上、右上、右下、左下对应的目标位置
+         */
+        void AddQuad(const Sprite& sprite, const SDL_FPoint (&corners)[4],
+                     uint8_t r, uint8_t g, uint8_t b, uint8_t a, SDL_BlendMode blendMode);
+
+        SDL_Renderer* m_renderer; // 不拥有所有权
+
+        SDL_Texture* m_texture = nullptr;
+        SDL_BlendMode m_blendMode = SDL_BLENDMODE_BLEND;
+
+        std::vector<SDL_Vertex> m_vertices;
+        std::vector<int> m_indices;
+
+        Stats m_stats;
+        Stats m_lastFrameStats;
+    };
+} // namespace Match3
@@ -51,6 +51,7 @@ namespace Match3
 
         m_width = width;
         m_height = height;
+        ++s_createdCount;
 
         // 设置混合模式
         SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
@@ -67,6 +68,81 @@ namespace Match3
         return true;
     }
 
+    bool Texture::CreateFromSurface(SDL_Renderer* renderer, SDL_Surface* surface)
+    {
+        Free();
+
+        if (!surface)
+        {
+            LOG_ERROR("Failed to create texture: surface is null");
+            return false;
+        }
+
+        m_texture = SDL_CreateTextureFromSurface(renderer, surface);
+        if (!m_texture)
+        {
+            LOG_ERROR("Failed to create texture from surface: {}", SDL_GetError());
+            return false;
+        }
+
+        m_width = surface->w;
+        m_height = surface->h;
+        ++s_createdCount;
+
+        SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
+        return true;
+    }
+
+    bool Texture::CreateBlank(SDL_Renderer* renderer, const int width, const int height, const SDL_PixelFormat format)
+    {
+        Free();
+
+        m_texture = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_STATIC, width, height);
+        if (!m_texture)
+        {
+            LOG_ERROR("Failed to create blank texture: {}", SDL_GetError());
+            return false;
+        }
+
+        m_width = width;
+        m_height = height;
+        ++s_createdCount;
+
+        SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
+        return true;
+    }
+
+    bool Texture::CreateRenderTarget(SDL_Renderer* renderer, const int width, const int height)
+    {
+        Free();
+
+        m_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+        if (!m_texture)
+        {
+            LOG_ERROR("Failed to create render target: {}", SDL_GetError());
+            return false;
+        }
+
+        m_width = width;
+        m_height = height;
+        ++s_createdCount;
+
+        SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
+        return true;
+    }
+
+    bool Texture::Update(const SDL_Rect& rect, const void* pixels, const int pitch)
+    {
+        if (!m_texture) return false;
+
+        if (!SDL_UpdateTexture(m_texture, &rect, pixels, pitch))
+        {
+            LOG_ERROR("Failed to update texture: {}", SDL_GetError());
+            return false;
+        }
+        return true;
+    }
+
     void Texture::Render(SDL_Renderer* renderer, const int x, const int y) const
     {
         if (!m_texture) return;
@@ -94,6 +170,7 @@ namespace Match3
         if (m_texture)
         {
             SDL_DestroyTexture(m_texture);
+            ++s_destroyedCount;
             m_texture = nullptr;
             m_width = 0;
             m_height = 0;
@@ -115,4 +192,12 @@ namespace Match3
             SDL_SetTextureAlphaMod(m_texture, alpha);
         }
     }
+
+    void Texture::SetScaleMode(const SDL_ScaleMode scaleMode)
+    {
+        if (m_texture)
+        {
+            SDL_SetTextureScaleMode(m_texture, scaleMode);
+        }
+    }
 } // namespace Match3
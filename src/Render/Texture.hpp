@@ -35,6 +35,43 @@ namespace Match3
         bool CreateFromColor(SDL_Renderer* renderer, int width, int height,
                              uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255);
 
+        /**
+         * @brief 从表面创建纹理（表面不会被释放）
+         * @param renderer SDL 渲染器
+         * @param surface 源表面
+         * @return 成功返回 true
+         */
+        bool CreateFromSurface(SDL_Renderer* renderer, SDL_Surface* surface);
+
+        /**
+         * @brief 创建空白纹理（内容由 Update() 分块上传，例如字形图集）
+         * @param renderer SDL 渲染器
+         * @param width 宽度
+         * @param height 高度
+         * @param format 像素格式
+         * @return 成功返回 true
+         */
+        bool CreateBlank(SDL_Renderer* renderer, int width, int height,
+                         SDL_PixelFormat format = SDL_PIXELFORMAT_ARGB8888);
+
+        /**
+         * @brief 创建渲染目标纹理（用于缓存静态图层）
+         * @param renderer SDL 渲染器
+         * @param width 宽度
+         * @param height 高度
+         * @return 成功返回 true
+         */
+        bool CreateRenderTarget(SDL_Renderer* renderer, int width, int height);
+
+        /**
+         * @brief 上传一块像素数据
+         * @param rect 目标区域
+         * @param pixels 像素数据（格式与纹理一致）
+         * @param pitch 每行字节数
+         * @return 成功返回 true
+         */
+        bool Update(const SDL_Rect& rect, const void* pixels, int pitch);
+
         /**
          * @brief 渲染纹理
          * @param renderer SDL 渲染器
@@ -73,6 +110,11 @@ namespace Match3
          */
         [[nodiscard]] int GetHeight() const { return m_height; }
 
+        /**
+         * @brief 获取底层 SDL 纹理
+         */
+        [[nodiscard]] SDL_Texture* GetSDLTexture() const { return m_texture; }
+
         /**
          * @brief 设置颜色调制
          */
@@ -83,7 +125,26 @@ namespace Match3
          */
         void SetAlpha(uint8_t alpha);
 
+        /**
+         * @brief 设置缩放过滤方式
+         */
+        void SetScaleMode(SDL_ScaleMode scaleMode);
+
+        /**
+         * @brief 程序启动以来创建的纹理总数（用于每帧统计）
+         */
+        [[nodiscard]] static uint64_t GetCreatedCount() { return s_createdCount; }
+
+        /**
+         * @brief 程序启动以来释放的纹理总数
+         */
+        [[nodiscard]] static uint64_t GetDestroyedCount() { return s_destroyedCount; }
+
     private:
+        // 纹理只在渲染线程创建和释放，计数无需同步
+        inline static uint64_t s_createdCount = 0;
+        inline static uint64_t s_destroyedCount = 0;
+
         SDL_Texture* m_texture = nullptr;
         int m_width = 0;
         int m_height = 0;
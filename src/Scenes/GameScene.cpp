@@ -2,14 +2,19 @@
 #include "MenuScene.hpp"
 #include "SceneManager.hpp"
 #include "Core/Logger.hpp"
+#include "Core/RenderStats.hpp"
 #include "Core/Config.hpp"
+#include "Core/LaunchOptions.hpp"
 #include "Render/Renderer.hpp"
 #include "Render/FontRenderer.hpp"
+#include "Render/RenderLayer.hpp"
 #include "Managers/GameStateManager.hpp"
+#include "Managers/SimulationThread.hpp"
 #include "Input/MouseHandler.hpp"
 #include "UI/UIManager.hpp"
 #include "UI/Components/Button.hpp"
 #include "UI/Components/Label.hpp"
+#include "UI/Components/NumberLabel.hpp"
 #include "UI/Components/Panel.hpp"
 #include <Display/DisplayManager.hpp>
 #include <SDL3/SDL.h>
@@ -25,6 +30,8 @@ namespace Match3
           , m_displayManager(displayManager)
           , m_gameState(std::make_unique<GameStateManager>(renderer))
           , m_uiManager(std::make_unique<UIManager>())
+          , m_backgroundLayer(std::make_unique<RenderLayer>(
+              renderer, [this](Renderer& target) { DrawBackground(target); }))
           , m_windowWidth(windowWidth)
           , m_windowHeight(windowHeight)
     {
@@ -39,6 +46,15 @@ namespace Match3
 
         // 初始化游戏状态
         m_gameState->Initialize(Config::BOARD_ROWS, Config::BOARD_COLS, Config::GEM_TYPES);
+        m_gameState->SetRenderViewport({0.0f, 0.0f, static_cast<float>(m_windowWidth),
+                                        static_cast<float>(m_windowHeight)});
+
+        // 可选：棋盘逻辑移到独立线程
+        if (LaunchOptions::Get().threadedSimulation)
+        {
+            m_simulation = std::make_unique<SimulationThread>(*m_gameState, Config::FIXED_TIMESTEP);
+            m_simulation->Start();
+        }
 
         CreateGameUI();
     }
@@ -46,64 +62,112 @@ namespace Match3
     void GameScene::OnExit()
     {
         LOG_INFO("GameScene: Exiting");
+        m_simulation.reset(); // 先停止模拟线程
         m_gameState.reset();
         m_uiManager.reset();
+        m_scoreLabel = m_movesLabel = m_comboLabel = nullptr;
     }
 
     void GameScene::Update(float deltaTime)
     {
-        // 更新游戏状态
-        if (m_gameState)
+        // 更新游戏状态（模拟线程模式下由模拟线程更新）
+        if (m_gameState && !m_simulation)
         {
             m_gameState->Update(deltaTime);
         }
 
         // 更新 UI
+        UpdateCounters(true);
         if (m_uiManager)
         {
             m_uiManager->Update(deltaTime);
         }
     }
 
+    void GameScene::UpdateCounters(const bool animate)
+    {
+        if (!m_scoreLabel || !m_gameState)
+            return;
+
+        // 模拟线程模式下只读最新快照，不跨线程访问游戏状态
+        const bool fromSnapshot = m_simulation != nullptr;
+        if (fromSnapshot && !m_currentSnapshot)
+            return;
+
+        const int score = fromSnapshot ? m_currentSnapshot->score : m_gameState->GetScore();
+        const int moves = fromSnapshot ? m_currentSnapshot->moves : m_gameState->GetMoves();
+        const int combo = fromSnapshot ? m_currentSnapshot->combo : m_gameState->GetCombo();
+
+        // 计数器只改数值，不格式化字符串也不重新光栅化文字
+        m_scoreLabel->SetValue(score, animate);
+        m_movesLabel->SetValue(moves, false);
+        m_comboLabel->SetValue(combo, false);
+        m_comboLabel->SetVisible(combo > 1);
+    }
+
     void GameScene::Render()
     {
-        // 清空屏幕
+        // 清空屏幕（覆盖逻辑分辨率之外的黑边区域）
         m_renderer->Clear(Config::BG_COLOR.r, Config::BG_COLOR.g,
                           Config::BG_COLOR.b, Config::BG_COLOR.a);
 
+        // 静态背景：只在尺寸变化或静态面板变化时重绘，平时一次贴图
+        if (m_uiManager && m_uiManager->IsStaticDirty())
+        {
+            m_backgroundLayer->Invalidate();
+        }
+        m_backgroundLayer->Composite(m_windowWidth, m_windowHeight);
+
+        // 渲染游戏内容
+        if (m_simulation)
+        {
+            const float alpha = m_simulation->ReadSnapshots(m_previousSnapshot, m_currentSnapshot);
+            m_gameState->RenderInterpolated(*m_previousSnapshot, *m_currentSnapshot, alpha);
+        }
+        else if (m_gameState)
+        {
+            m_gameState->Render();
+        }
+
+        // 渲染 UI（静态面板已在背景图层中）
+        if (m_uiManager)
+        {
+            m_uiManager->Render(m_renderer);
+        }
+
+        m_renderer->Present();
+    }
+
+    void GameScene::DrawBackground(Renderer& renderer)
+    {
+        renderer.Clear(Config::BG_COLOR.r, Config::BG_COLOR.g,
+                       Config::BG_COLOR.b, Config::BG_COLOR.a);
+
         // 绘制棋盘网格
-        m_renderer->SetDrawColor(Config::GRID_COLOR.r, Config::GRID_COLOR.g,
-                                 Config::GRID_COLOR.b, Config::GRID_COLOR.a);
+        renderer.SetDrawColor(Config::GRID_COLOR.r, Config::GRID_COLOR.g,
+                              Config::GRID_COLOR.b, Config::GRID_COLOR.a);
 
         // 绘制垂直线
         for (int col = 0; col <= Config::BOARD_COLS; ++col)
         {
             const int x = Config::BOARD_OFFSET_X + col * Config::GEM_SIZE;
-            m_renderer->DrawLine(x, Config::BOARD_OFFSET_Y,
-                                 x, Config::BOARD_OFFSET_Y + Config::BOARD_ROWS * Config::GEM_SIZE);
+            renderer.DrawLine(x, Config::BOARD_OFFSET_Y,
+                              x, Config::BOARD_OFFSET_Y + Config::BOARD_ROWS * Config::GEM_SIZE);
         }
 
         // 绘制水平线
         for (int row = 0; row <= Config::BOARD_ROWS; ++row)
         {
             const int y = Config::BOARD_OFFSET_Y + row * Config::GEM_SIZE;
-            m_renderer->DrawLine(Config::BOARD_OFFSET_X, y,
-                                 Config::BOARD_OFFSET_X + Config::BOARD_COLS * Config::GEM_SIZE, y);
+            renderer.DrawLine(Config::BOARD_OFFSET_X, y,
+                              Config::BOARD_OFFSET_X + Config::BOARD_COLS * Config::GEM_SIZE, y);
         }
 
-        // 渲染游戏内容
-        if (m_gameState)
-        {
-            m_gameState->Render();
-        }
-
-        // 渲染 UI
+        // 静态面板（HUD、信息栏背景）
         if (m_uiManager)
         {
-            m_uiManager->Render(m_renderer);
+            m_uiManager->RenderStatic(&renderer);
         }
-
-        m_renderer->Present();
     }
 
     bool GameScene::HandleMouseClick(int x, int y)
@@ -118,7 +182,10 @@ namespace Match3
             // 将点击传递给游戏状态管理器
             if (m_gameState)
             {
-                m_gameState->HandleClick(row, col);
+                RunOnSimulation([row, col](GameStateManager& gameState)
+                {
+                    gameState.HandleClick(row, col);
+                });
                 return true;
             }
         }
@@ -169,12 +236,34 @@ namespace Match3
         else if (key == SDLK_R)
         {
             LOG_INFO("R pressed - restarting game");
-            m_gameState->Initialize(Config::BOARD_ROWS, Config::BOARD_COLS, Config::GEM_TYPES);
+            RunOnSimulation([](GameStateManager& gameState) { gameState.Reset(); }, true);
+            return true;
+        }
+        else if (key == SDLK_F5 && LaunchOptions::Get().debugKeys)
+        {
+            RunOnSimulation([](GameStateManager& gameState) { gameState.SaveCheckpoint(); });
+            return true;
+        }
+        else if (key == SDLK_F9 && LaunchOptions::Get().debugKeys)
+        {
+            RunOnSimulation([](GameStateManager& gameState) { gameState.LoadCheckpoint(); }, true);
             return true;
         }
         return false;
     }
 
+    void GameScene::RunOnSimulation(std::function<void(GameStateManager&)> command, bool discontinuous)
+    {
+        if (m_simulation)
+        {
+            m_simulation->Post(std::move(command), discontinuous);
+        }
+        else if (m_gameState)
+        {
+            command(*m_gameState);
+        }
+    }
+
     void GameScene::CreateGameUI()
     {
         LOG_INFO("GameScene: Creating game UI");
@@ -186,15 +275,37 @@ namespace Match3
         hudPanel->SetBorderColor(100, 100, 150, 255);
         hudPanel->SetId("hud_panel");
         hudPanel->SetZOrder(0);
+        hudPanel->SetStatic(true);
         m_uiManager->AddComponent(hudPanel);
 
-        // 创建分数标签（左侧）
-        auto scoreLabel = std::make_shared<Label>(20, 30, "分数: 0", "default");
+        // 创建分数、步数、连击计数器（左侧）
+        auto scoreLabel = std::make_shared<NumberLabel>(20, 30, "分数: ", "default");
         scoreLabel->SetColor(255, 255, 255, 255);
         scoreLabel->SetFontRenderer(m_fontRenderer);
         scoreLabel->SetId("score_label");
         scoreLabel->SetZOrder(1);
         m_uiManager->AddComponent(scoreLabel);
+        m_scoreLabel = scoreLabel.get();
+
+        auto movesLabel = std::make_shared<NumberLabel>(220, 30, "步数: ", "default");
+        movesLabel->SetColor(200, 200, 220, 255);
+        movesLabel->SetFontRenderer(m_fontRenderer);
+        movesLabel->SetId("moves_label");
+        movesLabel->SetZOrder(1);
+        m_uiManager->AddComponent(movesLabel);
+        m_movesLabel = movesLabel.get();
+
+        auto comboLabel = std::make_shared<NumberLabel>(380, 30, "连击 x", "default");
+        comboLabel->SetColor(255, 210, 80, 255);
+        comboLabel->SetFontRenderer(m_fontRenderer);
+        comboLabel->SetId("combo_label");
+        comboLabel->SetZOrder(1);
+        comboLabel->SetVisible(false);
+        m_uiManager->AddComponent(comboLabel);
+        m_comboLabel = comboLabel.get();
+
+        // 重建 UI（如窗口尺寸变化）时直接显示当前值
+        UpdateCounters(false);
 
         // 创建返回菜单按钮（右上角）
         auto menuButton = std::make_shared<Button>(
@@ -221,6 +332,7 @@ namespace Match3
         infoPanel->SetBorderColor(100, 100, 150, 255);
         infoPanel->SetId("info_panel");
         infoPanel->SetZOrder(0);
+        infoPanel->SetStatic(true);
         m_uiManager->AddComponent(infoPanel);
 
         // 创建信息标签
@@ -240,12 +352,50 @@ namespace Match3
         LOG_INFO("GameScene: Handling window resize to {}x{}", width, height);
         m_windowWidth = width;
         m_windowHeight = height;
+        m_gameState->SetRenderViewport({0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height)});
         
         // Recreate UI with new dimensions
         m_uiManager.reset();
         m_uiManager = std::make_unique<UIManager>();
         m_uiManager->SetFontRenderer(m_fontRenderer);
         CreateGameUI();
+
+        // 尺寸或显示缩放变化后重绘背景图层
+        m_backgroundLayer->Invalidate();
     }
 
+    void GameScene::CollectRenderStats(RenderStats& stats) const
+    {
+        if (m_uiManager)
+        {
+            stats.ui = m_uiManager->GetFrameStats();
+        }
+        if (m_gameState)
+        {
+            stats.entities = m_gameState->GetRenderSystemStats();
+        }
+    }
+
+    bool GameScene::NeedsRedraw() const
+    {
+        // 模拟线程模式下每帧都有新的插值位置
+        if (m_dirty || m_simulation)
+        {
+            return true;
+        }
+        if (m_uiManager && m_uiManager->IsDirty())
+        {
+            return true;
+        }
+        return m_gameState && m_gameState->IsAnimating();
+    }
+
+    void GameScene::ClearRedrawFlag()
+    {
+        Scene::ClearRedrawFlag();
+        if (m_uiManager)
+        {
+            m_uiManager->ClearDirty();
+        }
+    }
 } // namespace Match3
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Scene.hpp"
+#include "Systems/RenderSnapshot.hpp"
+#include <functional>
 #include <memory>
 
 
@@ -15,8 +17,11 @@ namespace Match3
     class UIManager;
     class FontRenderer;
     class GameStateManager;
+    class SimulationThread;
+    class RenderLayer;
     class InputManager;
     class SceneManager;
+    class NumberLabel;
 
     /**
      * @brief 游戏场景
@@ -44,16 +49,46 @@ namespace Match3
         [[nodiscard]] std::string GetName() const override { return "GameScene"; }
 
         void HandleWindowResize(int width, int height) override;
+        void CollectRenderStats(RenderStats& stats) const override;
+
+        [[nodiscard]] bool NeedsRedraw() const override;
+        void ClearRedrawFlag() override;
 
     private:
         void CreateGameUI();
 
+        /**
+         * @brief 把分数/步数/连击同步到 HUD 计数器
+         * @param animate 分数增加时是否滚动显示
+         */
+        void UpdateCounters(bool animate);
+
+        /**
+         * @brief 绘制静态背景（清屏、棋盘网格、静态面板），由背景图层缓存
+         */
+        void DrawBackground(Renderer& renderer);
+
+        /**
+         * @brief 在游戏逻辑所在的线程上执行操作
+         * 模拟线程模式下投递到模拟线程，否则立即执行
+         */
+        void RunOnSimulation(std::function<void(GameStateManager&)> command, bool discontinuous = false);
+
         Renderer* m_renderer;
         FontRenderer* m_fontRenderer;
         SceneManager* m_sceneManager;
         Display::DisplayManager* m_displayManager;
         std::unique_ptr<GameStateManager> m_gameState;
+        std::unique_ptr<SimulationThread> m_simulation; // 可选，--threaded-sim 时创建
+        const Systems::RenderSnapshot* m_previousSnapshot = nullptr; // 从 m_simulation 借出，下次读取前有效
+        const Systems::RenderSnapshot* m_currentSnapshot = nullptr;
         std::unique_ptr<UIManager> m_uiManager;
+        std::unique_ptr<RenderLayer> m_backgroundLayer;
+
+        // HUD 计数器（由 m_uiManager 持有）
+        NumberLabel* m_scoreLabel = nullptr;
+        NumberLabel* m_movesLabel = nullptr;
+        NumberLabel* m_comboLabel = nullptr;
         int m_windowWidth;
         int m_windowHeight;
     };
@@ -3,6 +3,7 @@
 #include "SettingsScene.hpp"
 #include "SceneManager.hpp"
 #include "Core/Logger.hpp"
+#include "Core/RenderStats.hpp"
 #include "Core/Config.hpp"
 #include "Render/Renderer.hpp"
 #include "Render/FontRenderer.hpp"
@@ -239,4 +240,25 @@ namespace Match3
         CreateMenuUI();
     }
 
+    void MenuScene::CollectRenderStats(RenderStats& stats) const
+    {
+        if (m_uiManager)
+        {
+            stats.ui = m_uiManager->GetFrameStats();
+        }
+    }
+
+    bool MenuScene::NeedsRedraw() const
+    {
+        return m_dirty || (m_uiManager && m_uiManager->IsDirty());
+    }
+
+    void MenuScene::ClearRedrawFlag()
+    {
+        Scene::ClearRedrawFlag();
+        if (m_uiManager)
+        {
+            m_uiManager->ClearDirty();
+        }
+    }
 } // namespace Match3
@@ -41,6 +41,10 @@ namespace Match3
         [[nodiscard]] std::string GetName() const override { return "MenuScene"; }
 
         void HandleWindowResize(int width, int height) override;
+        void CollectRenderStats(RenderStats& stats) const override;
+
+        [[nodiscard]] bool NeedsRedraw() const override;
+        void ClearRedrawFlag() override;
 
     private:
         void CreateMenuUI();
@@ -7,6 +7,7 @@ namespace Match3
     class Renderer;
     class UIManager;
     class FontRenderer;
+    struct RenderStats;
 
     /**
      * @brief Scene 基类 - 所有场景的基类
@@ -104,7 +105,30 @@ namespace Match3
          */
         virtual void HandleWindowResize(int width, int height) {}
 
+        /**
+         * @brief 填写场景自身的渲染统计（UI 组件、实体），由 Game 每帧渲染后收集
+         */
+        virtual void CollectRenderStats(RenderStats& stats) const {}
+
+        /**
+         * @brief 是否需要重绘（损伤跟踪模式下返回 false 时跳过 Render）
+         * 子类可叠加 UI 脏标记或正在播放的动画
+         */
+        [[nodiscard]] virtual bool NeedsRedraw() const { return m_dirty; }
+
+        /**
+         * @brief 帧已渲染，清除脏标记
+         */
+        virtual void ClearRedrawFlag() { m_dirty = false; }
+
+        /**
+         * @brief 标记下一帧需要重绘
+         */
+        void MarkDirty() { m_dirty = true; }
+
     protected:
         Scene() = default;
+
+        bool m_dirty = true; // 新场景首帧必须绘制
     };
 } // namespace Match3
@@ -55,6 +55,7 @@ namespace Match3
         if (!m_sceneStack.empty())
         {
             m_sceneStack.top()->OnResume();
+            m_sceneStack.top()->MarkDirty();
         }
     }
 
@@ -157,6 +158,28 @@ namespace Match3
         if (!m_sceneStack.empty())
         {
             m_sceneStack.top()->HandleWindowResize(width, height);
+            m_sceneStack.top()->MarkDirty();
+        }
+    }
+
+    bool SceneManager::NeedsRedraw() const
+    {
+        return !m_sceneStack.empty() && m_sceneStack.top()->NeedsRedraw();
+    }
+
+    void SceneManager::ClearRedrawFlag()
+    {
+        if (!m_sceneStack.empty())
+        {
+            m_sceneStack.top()->ClearRedrawFlag();
+        }
+    }
+
+    void SceneManager::MarkDirty()
+    {
+        if (!m_sceneStack.empty())
+        {
+            m_sceneStack.top()->MarkDirty();
         }
     }
 
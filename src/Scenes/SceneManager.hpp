@@ -116,6 +116,21 @@ namespace Match3
          */
         void NotifyWindowResize(int width, int height);
 
+        /**
+         * @brief 当前场景是否需要重绘
+         */
+        [[nodiscard]] bool NeedsRedraw() const;
+
+        /**
+         * @brief 清除当前场景的重绘标记（在 Render 之后调用）
+         */
+        void ClearRedrawFlag();
+
+        /**
+         * @brief 标记当前场景需要重绘（输入、窗口事件等）
+         */
+        void MarkDirty();
+
     private:
         std::stack<std::unique_ptr<Scene>> m_sceneStack;
     };
@@ -1,6 +1,7 @@
 #include "SettingsScene.hpp"
 #include "SceneManager.hpp"
 #include "Core/Logger.hpp"
+#include "Core/RenderStats.hpp"
 #include "Render/Renderer.hpp"
 #include "Render/FontRenderer.hpp"
 #include "UI/UIManager.hpp"
@@ -361,7 +362,7 @@ namespace Match3
         infoLabel->SetFontRenderer(m_fontRenderer);
         infoLabel->SetId("info_label");
         infoLabel->SetZOrder(1);
-        m_uiManager->AddComponent(infoLabel);
+        m_infoLabelId = m_uiManager->AddComponent(infoLabel);
 
         // Update display info
         UpdateDisplayInfo();
@@ -401,7 +402,7 @@ namespace Match3
         auto displayInfo = m_displayManager->GetDisplayInfo();
 
         // Update info label
-        auto infoLabel = std::dynamic_pointer_cast<Label>(m_uiManager->GetComponent("info_label"));
+        auto infoLabel = std::dynamic_pointer_cast<Label>(m_uiManager->GetComponent(m_infoLabelId));
         if (infoLabel)
         {
             char buffer[256];
@@ -456,4 +457,26 @@ namespace Match3
 
         CreateSettingsUI();
     }
+
+    void SettingsScene::CollectRenderStats(RenderStats& stats) const
+    {
+        if (m_uiManager)
+        {
+            stats.ui = m_uiManager->GetFrameStats();
+        }
+    }
+
+    bool SettingsScene::NeedsRedraw() const
+    {
+        return m_dirty || (m_uiManager && m_uiManager->IsDirty());
+    }
+
+    void SettingsScene::ClearRedrawFlag()
+    {
+        Scene::ClearRedrawFlag();
+        if (m_uiManager)
+        {
+            m_uiManager->ClearDirty();
+        }
+    }
 } // namespace Match3
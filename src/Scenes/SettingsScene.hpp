@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Scene.hpp"
+#include "UI/Components/UIComponent.hpp"
 #include <memory>
 #include <vector>
 
@@ -43,6 +44,10 @@ namespace Match3
         [[nodiscard]] std::string GetName() const override { return "SettingsScene"; }
 
         void HandleWindowResize(int width, int height) override;
+        void CollectRenderStats(RenderStats& stats) const override;
+
+        [[nodiscard]] bool NeedsRedraw() const override;
+        void ClearRedrawFlag() override;
 
     private:
         void CreateSettingsUI();
@@ -54,6 +59,7 @@ namespace Match3
         SceneManager* m_sceneManager;
         Display::DisplayManager* m_displayManager; // Not owned
         std::unique_ptr<UIManager> m_uiManager;
+        UiId m_infoLabelId; // 分辨率信息标签，创建界面时记录
         int m_windowWidth;
         int m_windowHeight;
 
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <cstdint>
+
+namespace Match3::Systems {
+
+/**
+ * @brief 动画通道 - 对应一种一次性动画组件
+ */
+enum class AnimationChannel : uint8_t {
+    Tween,
+    Scale,
+    Fade,
+    Rotation
+};
+
+/**
+ * @brief 动画完成事件
+ * 
+ * AnimationSystem 在动画结束时放入 dispatcher 队列，
+ * 由 GameStateManager 在所有系统更新后统一派发。
+ */
+struct AnimationFinishedEvent {
+    entt::entity entity;
+    AnimationChannel channel;
+    uint32_t group;                 // 动画组ID（0 表示不属于任何组）
+};
+
+} // namespace Match3::Systems
@@ -0,0 +1,66 @@
+#include "AnimationLatches.hpp"
+#include "Core/Logger.hpp"
+
+namespace Match3::Systems {
+
+AnimationLatches::AnimationLatches(entt::dispatcher& dispatcher)
+    : m_dispatcher(dispatcher)
+{
+    m_dispatcher.sink<AnimationFinishedEvent>().connect<&AnimationLatches::OnAnimationFinished>(*this);
+}
+
+AnimationLatches::~AnimationLatches()
+{
+    m_dispatcher.sink<AnimationFinishedEvent>().disconnect<&AnimationLatches::OnAnimationFinished>(*this);
+}
+
+uint32_t AnimationLatches::Create(uint32_t count, Callback callback)
+{
+    if (count == 0) {
+        if (callback) {
+            callback();
+        }
+        return 0;
+    }
+    
+    // 跳过 0（保留给“不属于任何组”）
+    if (m_nextGroup == 0) {
+        m_nextGroup = 1;
+    }
+    const uint32_t group = m_nextGroup++;
+    
+    m_latches.insert_or_assign(group, Latch{count, std::move(callback)});
+    return group;
+}
+
+void AnimationLatches::Cancel(uint32_t group)
+{
+    m_latches.erase(group);
+}
+
+void AnimationLatches::Clear()
+{
+    m_latches.clear();
+}
+
+void AnimationLatches::OnAnimationFinished(const AnimationFinishedEvent& event)
+{
+    if (event.group == 0) return;
+    
+    auto it = m_latches.find(event.group);
+    if (it == m_latches.end()) return;
+    
+    if (--it->second.remaining > 0) return;
+    
+    // 先移出再回调，回调中可以安全地创建新的闭锁
+    Callback callback = std::move(it->second.callback);
+    m_latches.erase(it);
+    
+    LOG_DEBUG("AnimationLatches: Group {} completed", event.group);
+    
+    if (callback) {
+        callback();
+    }
+}
+
+} // namespace Match3::Systems
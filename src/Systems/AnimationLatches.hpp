@@ -0,0 +1,70 @@
+#pragma once
+
+#include "AnimationEvents.hpp"
+#include <ankerl/unordered_dense.h>
+#include <cstdint>
+#include <functional>
+
+namespace Match3::Systems {
+
+/**
+ * @brief 动画组倒计数闭锁
+ * 
+ * 为一组动画分配组ID和计数，每收到一个该组的 AnimationFinishedEvent 计数减一，
+ * 归零时回调恰好触发一次。用于替代每帧轮询动画组件是否存在。
+ * 
+ * 用法：
+ *   const uint32_t group = latches.Create(2, [this] { ... });
+ *   registry.emplace_or_replace<TweenAnimation>(e1, ...).group = group;
+ *   registry.emplace_or_replace<TweenAnimation>(e2, ...).group = group;
+ * 
+ * 注意：组内动画在完成前被替换或实体被销毁时不会产生完成事件，
+ * 需要调用 Cancel() 取消对应的闭锁。
+ */
+class AnimationLatches {
+public:
+    using Callback = std::function<void()>;
+    
+    explicit AnimationLatches(entt::dispatcher& dispatcher);
+    ~AnimationLatches();
+    
+    AnimationLatches(const AnimationLatches&) = delete;
+    AnimationLatches& operator=(const AnimationLatches&) = delete;
+    
+    /**
+     * @brief 创建闭锁
+     * @param count 组内动画数量
+     * @param callback 最后一个动画完成时的回调
+     * @return 组ID；count 为 0 时立即执行回调并返回 0
+     */
+    uint32_t Create(uint32_t count, Callback callback);
+    
+    /**
+     * @brief 取消闭锁（回调不会被触发）
+     */
+    void Cancel(uint32_t group);
+    
+    /**
+     * @brief 取消所有闭锁
+     */
+    void Clear();
+    
+    /**
+     * @brief 获取未完成的闭锁数量
+     */
+    [[nodiscard]] size_t GetActiveCount() const { return m_latches.size(); }
+    
+private:
+    struct Latch {
+        uint32_t remaining;
+        Callback callback;
+    };
+    
+    void OnAnimationFinished(const AnimationFinishedEvent& event);
+    
+    entt::dispatcher& m_dispatcher;
+    ankerl::unordered_dense::map<uint32_t, Latch> m_latches;
+    uint32_t m_nextGroup = 1;
+};
+
+} // namespace Match3::Systems
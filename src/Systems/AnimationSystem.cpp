@@ -1,26 +1,79 @@
 #include "AnimationSystem.hpp"
 #include "Core/Logger.hpp"
-#include "Utils/Easing.hpp"
 
 namespace Match3::Systems {
 
+AnimationSystem::AnimationSystem(entt::dispatcher& dispatcher)
+    : m_dispatcher(dispatcher)
+{
+}
+
 void AnimationSystem::Update(entt::registry& registry, float deltaTime)
 {
     if (!m_enabled) return;
     
+    m_batch.Clear();
+    m_tracks.clear();
+    
     UpdateTweenAnimations(registry, deltaTime);
     UpdateScaleAnimations(registry, deltaTime);
     UpdateFadeAnimations(registry, deltaTime);
     UpdateRotationAnimations(registry, deltaTime);
+    
+    // 按缓动类型批量求值，再统一写回
+    m_batch.Evaluate(m_useLookupTables);
+    ApplyTracks(registry);
+    
+    // 脉冲最后写入缩放，与缩放动画同时存在时以脉冲为准
     UpdatePulseAnimations(registry, deltaTime);
 }
 
+void AnimationSystem::QueueTrack(entt::entity entity, AnimationChannel channel,
+                                 Components::EasingType easing, float progress)
+{
+    m_tracks.push_back({entity, channel, m_batch.Add(easing, progress)});
+}
+
+void AnimationSystem::ApplyTracks(entt::registry& registry)
+{
+    for (const auto& track : m_tracks) {
+        const float t = m_batch.Get(track.slot);
+        
+        switch (track.channel) {
+            case AnimationChannel::Tween: {
+                auto& pos = registry.get<Components::Position>(track.entity);
+                const auto& anim = registry.get<Components::TweenAnimation>(track.entity);
+                pos.x = Lerp(anim.startX, anim.endX, t);
+                pos.y = Lerp(anim.startY, anim.endY, t);
+                break;
+            }
+            case AnimationChannel::Scale: {
+                auto& render = registry.get<Components::Renderable>(track.entity);
+                const auto& anim = registry.get<Components::ScaleAnimation>(track.entity);
+                render.scale = Lerp(anim.startScale, anim.endScale, t);
+                break;
+            }
+            case AnimationChannel::Fade: {
+                auto& render = registry.get<Components::Renderable>(track.entity);
+                const auto& anim = registry.get<Components::FadeAnimation>(track.entity);
+                const float alpha = Lerp(anim.startAlpha, anim.endAlpha, t);
+                render.a = static_cast<uint8_t>(alpha * 255.0f);
+                break;
+            }
+            case AnimationChannel::Rotation: {
+                auto& render = registry.get<Components::Renderable>(track.entity);
+                const auto& anim = registry.get<Components::RotationAnimation>(track.entity);
+                render.rotation = Lerp(anim.startRotation, anim.endRotation, t);
+                break;
+            }
+        }
+    }
+}
+
 void AnimationSystem::UpdateTweenAnimations(entt::registry& registry, float dt)
 {
     auto view = registry.view<Components::Position, Components::TweenAnimation>();
     
-    std::vector<entt::entity> finishedAnims;
-    
     for (auto entity : view) {
         auto& pos = view.get<Components::Position>(entity);
         auto& anim = view.get<Components::TweenAnimation>(entity);
@@ -34,19 +87,11 @@ void AnimationSystem::UpdateTweenAnimations(entt::registry& registry, float dt)
             pos.x = anim.endX;
             pos.y = anim.endY;
             anim.finished = true;
-            finishedAnims.push_back(entity);
+            m_dispatcher.enqueue(AnimationFinishedEvent{entity, AnimationChannel::Tween, anim.group});
+            m_commands->Remove<Components::TweenAnimation>(entity);     // 在同步点移除
         } else {
-            // 计算插值
-            const float t = ApplyEasing(anim.GetProgress(), anim.easing);
-            pos.x = Lerp(anim.startX, anim.endX, t);
-            pos.y = Lerp(anim.startY, anim.endY, t);
-        }
-    }
-    
-    // 移除已完成的动画组件
-    for (auto entity : finishedAnims) {
-        if (registry.valid(entity)) {
-            registry.remove<Components::TweenAnimation>(entity);
+            // 进度加入批处理，求值后再插值
+            QueueTrack(entity, AnimationChannel::Tween, anim.easing, anim.GetProgress());
         }
     }
 }
@@ -55,8 +100,6 @@ void AnimationSystem::UpdateScaleAnimations(entt::registry& registry, float dt)
 {
     auto view = registry.view<Components::Renderable, Components::ScaleAnimation>();
     
-    std::vector<entt::entity> finishedAnims;
-    
     for (auto entity : view) {
         auto& render = view.get<Components::Renderable>(entity);
         auto& anim = view.get<Components::ScaleAnimation>(entity);
@@ -69,18 +112,11 @@ void AnimationSystem::UpdateScaleAnimations(entt::registry& registry, float dt)
             // 动画完成
             render.scale = anim.endScale;
             anim.finished = true;
-            finishedAnims.push_back(entity);
+            m_dispatcher.enqueue(AnimationFinishedEvent{entity, AnimationChannel::Scale, anim.group});
+            m_commands->Remove<Components::ScaleAnimation>(entity);     // 在同步点移除
         } else {
-            // 计算插值
-            const float t = ApplyEasing(anim.GetProgress(), anim.easing);
-            render.scale = Lerp(anim.startScale, anim.endScale, t);
-        }
-    }
-    
-    // 移除已完成的动画组件
-    for (auto entity : finishedAnims) {
-        if (registry.valid(entity)) {
-            registry.remove<Components::ScaleAnimation>(entity);
+            // 进度加入批处理，求值后再插值
+            QueueTrack(entity, AnimationChannel::Scale, anim.easing, anim.GetProgress());
         }
     }
 }
@@ -89,8 +125,6 @@ void AnimationSystem::UpdateFadeAnimations(entt::registry& registry, float dt)
 {
     auto view = registry.view<Components::Renderable, Components::FadeAnimation>();
     
-    std::vector<entt::entity> finishedAnims;
-    
     for (auto entity : view) {
         auto& render = view.get<Components::Renderable>(entity);
         auto& anim = view.get<Components::FadeAnimation>(entity);
@@ -104,19 +138,11 @@ void AnimationSystem::UpdateFadeAnimations(entt::registry& registry, float dt)
             const float alpha = anim.endAlpha;
             render.a = static_cast<uint8_t>(alpha * 255.0f);
             anim.finished = true;
-            finishedAnims.push_back(entity);
+            m_dispatcher.enqueue(AnimationFinishedEvent{entity, AnimationChannel::Fade, anim.group});
+            m_commands->Remove<Components::FadeAnimation>(entity);     // 在同步点移除
         } else {
-            // 计算插值
-            const float t = ApplyEasing(anim.GetProgress(), anim.easing);
-            const float alpha = Lerp(anim.startAlpha, anim.endAlpha, t);
-            render.a = static_cast<uint8_t>(alpha * 255.0f);
-        }
-    }
-    
-    // 移除已完成的动画组件
-    for (auto entity : finishedAnims) {
-        if (registry.valid(entity)) {
-            registry.remove<Components::FadeAnimation>(entity);
+            // 进度加入批处理，求值后再插值
+            QueueTrack(entity, AnimationChannel::Fade, anim.easing, anim.GetProgress());
         }
     }
 }
@@ -125,8 +151,6 @@ void AnimationSystem::UpdateRotationAnimations(entt::registry& registry, float d
 {
     auto view = registry.view<Components::Renderable, Components::RotationAnimation>();
     
-    std::vector<entt::entity> finishedAnims;
-    
     for (auto entity : view) {
         auto& render = view.get<Components::Renderable>(entity);
         auto& anim = view.get<Components::RotationAnimation>(entity);
@@ -139,18 +163,11 @@ void AnimationSystem::UpdateRotationAnimations(entt::registry& registry, float d
             // 动画完成
             render.rotation = anim.endRotation;
             anim.finished = true;
-            finishedAnims.push_back(entity);
+            m_dispatcher.enqueue(AnimationFinishedEvent{entity, AnimationChannel::Rotation, anim.group});
+            m_commands->Remove<Components::RotationAnimation>(entity);     // 在同步点移除
         } else {
-            // 计算插值
-            const float t = ApplyEasing(anim.GetProgress(), anim.easing);
-            render.rotation = Lerp(anim.startRotation, anim.endRotation, t);
-        }
-    }
-    
-    // 移除已完成的动画组件
-    for (auto entity : finishedAnims) {
-        if (registry.valid(entity)) {
-            registry.remove<Components::RotationAnimation>(entity);
+            // 进度加入批处理，求值后再插值
+            QueueTrack(entity, AnimationChannel::Rotation, anim.easing, anim.GetProgress());
         }
     }
 }
@@ -174,32 +191,4 @@ void AnimationSystem::UpdatePulseAnimations(entt::registry& registry, float dt)
     }
 }
 
-float AnimationSystem::ApplyEasing(float t, Components::EasingType type) const
-{
-    using namespace Match3::Easing;
-    
-    switch (type) {
-        case Components::EasingType::Linear:
-            return Linear(t);
-        case Components::EasingType::InQuad:
-            return InQuad(t);
-        case Components::EasingType::OutQuad:
-            return OutQuad(t);
-        case Components::EasingType::InOutQuad:
-            return InOutQuad(t);
-        case Components::EasingType::InCubic:
-            return InCubic(t);
-        case Components::EasingType::OutCubic:
-            return OutCubic(t);
-        case Components::EasingType::InOutCubic:
-            return InOutCubic(t);
-        case Components::EasingType::OutBounce:
-            return OutBounce(t);
-        case Components::EasingType::OutBack:
-            return OutBack(t);
-        default:
-            return t;
-    }
-}
-
 } // namespace Match3::Systems
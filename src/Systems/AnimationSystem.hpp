@@ -1,9 +1,12 @@
 #pragma once
 
 #include "System.hpp"
+#include "AnimationEvents.hpp"
 #include "../Components/Common.hpp"
 #include "../Components/Animation.hpp"
+#include "Utils/EasingBatch.hpp"
 #include <cmath>
+#include <vector>
 
 namespace Match3::Systems {
 
@@ -16,30 +19,58 @@ namespace Match3::Systems {
  * - FadeAnimation: 淡出动画
  * - RotationAnimation: 旋转动画
  * - PulseAnimation: 脉冲动画（循环）
+ *
+ * 每帧先推进所有动画的计时并收集进度，再按缓动类型批量求值，最后写回组件。
+ * 一次性动画结束时向 dispatcher 投递 AnimationFinishedEvent。
  */
 class AnimationSystem : public System {
 public:
-    AnimationSystem() = default;
+    explicit AnimationSystem(entt::dispatcher& dispatcher);
     
     void Update(entt::registry& registry, float deltaTime) override;
     
     [[nodiscard]] const char* GetName() const override { return "AnimationSystem"; }
     
+    /**
+     * @brief 是否对开销较大的曲线（OutBounce/OutBack）使用查找表
+     * 误差上界见 Utils/EasingBatch.hpp
+     */
+    void SetUseLookupTables(bool enabled) { m_useLookupTables = enabled; }
+    [[nodiscard]] bool IsUsingLookupTables() const { return m_useLookupTables; }
+    
 private:
-    // 各种动画更新函数
+    /**
+     * @brief 待写回的动画轨道
+     */
+    struct Track {
+        entt::entity entity;
+        AnimationChannel channel;
+        Easing::EasingBatch::Slot slot;
+    };
+    
+    // 各种动画更新函数（推进计时，收集未完成动画的进度）
     void UpdateTweenAnimations(entt::registry& registry, float dt);
     void UpdateScaleAnimations(entt::registry& registry, float dt);
     void UpdateFadeAnimations(entt::registry& registry, float dt);
     void UpdateRotationAnimations(entt::registry& registry, float dt);
     void UpdatePulseAnimations(entt::registry& registry, float dt);
     
-    // 应用缓动函数
-    [[nodiscard]] float ApplyEasing(float t, Components::EasingType type) const;
+    // 将批量求值结果写回组件
+    void ApplyTracks(entt::registry& registry);
+    
+    // 加入批处理
+    void QueueTrack(entt::entity entity, AnimationChannel channel,
+                    Components::EasingType easing, float progress);
     
     // 线性插值
     [[nodiscard]] float Lerp(float a, float b, float t) const {
         return a + (b - a) * t;
     }
+    
+    entt::dispatcher& m_dispatcher;
+    Easing::EasingBatch m_batch;
+    std::vector<Track> m_tracks;
+    bool m_useLookupTables = false;
 };
 
 } // namespace Match3::Systems
@@ -1,5 +1,6 @@
 #include "BoardSystem.hpp"
 #include "Core/Logger.hpp"
+#include "Utils/Random.hpp"
 #include <random>
 #include <algorithm>
 
@@ -32,8 +33,7 @@ void BoardSystem::InitializeBoard(entt::registry& registry, int gemTypes)
 {
     LOG_INFO("{}: Initializing board with {} gem types", GetName(), gemTypes);
     
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    auto& gen = Random::Engine();
     std::uniform_int_distribution<int> typeDist(0, gemTypes - 1);
     
     // 创建所有宝石实体
@@ -63,8 +63,8 @@ void BoardSystem::RebuildGridIndex(entt::registry& registry)
         const auto& gridPos = view.get<Components::GridPosition>(entity);
         const auto& gem = view.get<Components::Gem>(entity);
         
-        // 跳过空宝石
-        if (gem.IsEmpty()) {
+        // 跳过空宝石和已匹配（等待销毁）的宝石
+        if (gem.IsEmpty() || gem.IsMatched()) {
             continue;
         }
         
@@ -77,6 +77,31 @@ void BoardSystem::RebuildGridIndex(entt::registry& registry)
     LOG_DEBUG("{}: Rebuilt grid index with {} gems", GetName(), count);
 }
 
+void BoardSystem::ExportGrid(std::vector<entt::entity>& cells) const
+{
+    cells.clear();
+    cells.reserve(static_cast<size_t>(m_rows) * m_cols);
+    for (const auto& row : m_grid) {
+        cells.insert(cells.end(), row.begin(), row.end());
+    }
+}
+
+bool BoardSystem::ImportGrid(const std::vector<entt::entity>& cells)
+{
+    if (cells.size() != static_cast<size_t>(m_rows) * m_cols) {
+        LOG_ERROR("{}: Grid size mismatch ({} cells, expected {})", 
+                  GetName(), cells.size(), m_rows * m_cols);
+        return false;
+    }
+    
+    auto it = cells.begin();
+    for (auto& row : m_grid) {
+        std::copy_n(it, m_cols, row.begin());
+        it += m_cols;
+    }
+    return true;
+}
+
 entt::entity BoardSystem::GetGemAt(int row, int col) const
 {
     if (!IsValidPosition(row, col)) {
@@ -166,8 +191,7 @@ int BoardSystem::ApplyGravity(entt::registry& registry)
 
 int BoardSystem::FillEmptySlots(entt::registry& registry, int gemTypes)
 {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    auto& gen = Random::Engine();
     std::uniform_int_distribution<int> typeDist(0, gemTypes - 1);
     
     int filledCount = 0;
@@ -36,7 +36,7 @@ public:
     void InitializeBoard(entt::registry& registry, int gemTypes);
     
     /**
-     * @brief 重建网格索引
+     * @brief 重建网格索引（已匹配的宝石不入索引）
      * @param registry ECS注册表
      */
     void RebuildGridIndex(entt::registry& registry);
@@ -88,6 +88,19 @@ public:
     [[nodiscard]] int GetRows() const { return m_rows; }
     [[nodiscard]] int GetCols() const { return m_cols; }
     
+    /**
+     * @brief 按行优先导出网格索引
+     * @param cells 输出（rows * cols 个实体）
+     */
+    void ExportGrid(std::vector<entt::entity>& cells) const;
+    
+    /**
+     * @brief 原地导入网格索引（用于快照恢复）
+     * @param cells 行优先的实体数组，尺寸必须与棋盘一致
+     * @return 尺寸不匹配时返回false
+     */
+    bool ImportGrid(const std::vector<entt::entity>& cells);
+    
 private:
     int m_rows, m_cols;
     EntityFactory& m_factory;
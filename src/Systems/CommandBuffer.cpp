@@ -0,0 +1,68 @@
+#include "CommandBuffer.hpp"
+#include <algorithm>
+
+namespace Match3::Systems {
+
+CommandBuffer::~CommandBuffer()
+{
+    Clear();
+}
+
+void CommandBuffer::Destroy(entt::entity entity)
+{
+    Record(CommandKind::Destroy, 0, entity, nullptr,
+           [](entt::registry& registry, entt::entity e, void*) {
+               registry.destroy(e);
+           },
+           nullptr);
+}
+
+size_t CommandBuffer::Flush(entt::registry& registry)
+{
+    size_t executed = 0;
+    
+    while (!m_commands.empty()) {
+        m_playback.swap(m_commands);
+        
+        // 按组件类型、实体稳定排序：同一存储的操作连续执行，
+        // 同一 (实体, 组件) 上的命令保持记录顺序
+        std::stable_sort(m_playback.begin(), m_playback.end(),
+            [](const Command& a, const Command& b) {
+                if (a.type != b.type) return a.type < b.type;
+                return entt::to_integral(a.entity) < entt::to_integral(b.entity);
+            });
+        
+        for (const auto& command : m_playback) {
+            // 实体可能已被之前的命令或其他逻辑销毁
+            if (command.kind != CommandKind::Create && !registry.valid(command.entity)) {
+                continue;
+            }
+            
+            command.apply(registry, command.entity, command.payload);
+            ++executed;
+        }
+        
+        ReleasePayloads(m_playback);
+    }
+    
+    m_arena.Reset();
+    return executed;
+}
+
+void CommandBuffer::Clear()
+{
+    ReleasePayloads(m_commands);
+    m_arena.Reset();
+}
+
+void CommandBuffer::ReleasePayloads(std::vector<Command>& commands)
+{
+    for (const auto& command : commands) {
+        if (command.destroy) {
+            command.destroy(command.payload);
+        }
+    }
+    commands.clear();
+}
+
+} // namespace Match3::Systems
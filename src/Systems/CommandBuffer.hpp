@@ -0,0 +1,143 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include "Utils/FrameArena.hpp"
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Match3::Systems {
+
+/**
+ * @brief 延迟结构变更命令缓冲
+ * 
+ * 系统在遍历视图时不直接创建/销毁实体或增删组件，而是记录到命令缓冲中，
+ * 由 SystemManager 在同步点统一回放。回放前按 (组件类型, 实体) 稳定排序，
+ * 同一存储上的操作连续执行。命令数据分配在帧内存池中，回放后整体重置。
+ * 
+ * 回放顺序：
+ * - 同一 (实体, 组件) 上的 Emplace/Remove 保持记录顺序，最后记录的生效
+ * - Create/Destroy 不属于任何组件存储，排在所有组件命令之前
+ * - 目标实体在回放时已失效的命令会被跳过
+ */
+class CommandBuffer {
+public:
+    enum class CommandKind : uint8_t {
+        Create,
+        Remove,
+        Emplace,
+        Destroy
+    };
+    
+    CommandBuffer() = default;
+    ~CommandBuffer();
+    
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+    
+    /**
+     * @brief 延迟创建实体
+     * @param init 回放时调用 init(registry, entity) 初始化新实体
+     */
+    template<typename Func>
+    void Create(Func&& init) {
+        using Fn = std::decay_t<Func>;
+        auto* payload = new (m_arena.Allocate(sizeof(Fn), alignof(Fn))) Fn(std::forward<Func>(init));
+        Record(CommandKind::Create, 0, entt::null, payload,
+               [](entt::registry& registry, entt::entity, void* p) {
+                   (*static_cast<Fn*>(p))(registry, registry.create());
+               },
+               DestroyerFor<Fn>());
+    }
+    
+    /**
+     * @brief 延迟添加（或替换）组件
+     * @return 暂存的组件，可在回放前继续修改
+     */
+    template<typename T, typename... Args>
+    T& Emplace(entt::entity entity, Args&&... args) {
+        void* memory = m_arena.Allocate(sizeof(T), alignof(T));
+        T* component = nullptr;
+        if constexpr (std::is_constructible_v<T, Args...>) {
+            component = new (memory) T(std::forward<Args>(args)...);
+        } else {
+            component = new (memory) T{std::forward<Args>(args)...};
+        }
+        
+        Record(CommandKind::Emplace, entt::type_hash<T>::value(), entity, component,
+               [](entt::registry& registry, entt::entity e, void* p) {
+                   registry.emplace_or_replace<T>(e, std::move(*static_cast<T*>(p)));
+               },
+               DestroyerFor<T>());
+        return *component;
+    }
+    
+    /**
+     * @brief 延迟移除组件（组件不存在时忽略）
+     */
+    template<typename T>
+    void Remove(entt::entity entity) {
+        Record(CommandKind::Remove, entt::type_hash<T>::value(), entity, nullptr,
+               [](entt::registry& registry, entt::entity e, void*) {
+                   registry.remove<T>(e);
+               },
+               nullptr);
+    }
+    
+    /**
+     * @brief 延迟销毁实体
+     */
+    void Destroy(entt::entity entity);
+    
+    /**
+     * @brief 回放所有命令并重置缓冲
+     * 回放过程中记录的新命令会在同一次调用中继续回放
+     * @return 实际执行的命令数量
+     */
+    size_t Flush(entt::registry& registry);
+    
+    /**
+     * @brief 丢弃所有未回放的命令
+     */
+    void Clear();
+    
+    [[nodiscard]] bool IsEmpty() const { return m_commands.empty(); }
+    [[nodiscard]] size_t GetPendingCount() const { return m_commands.size(); }
+    
+private:
+    using ApplyFn = void (*)(entt::registry&, entt::entity, void*);
+    using DestroyFn = void (*)(void*);
+    
+    struct Command {
+        CommandKind kind;
+        entt::id_type type;
+        entt::entity entity;
+        void* payload;
+        ApplyFn apply;
+        DestroyFn destroy;
+    };
+    
+    template<typename T>
+    static constexpr DestroyFn DestroyerFor() {
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            return nullptr;
+        } else {
+            return [](void* p) { static_cast<T*>(p)->~T(); };
+        }
+    }
+    
+    void Record(CommandKind kind, entt::id_type type, entt::entity entity,
+                void* payload, ApplyFn apply, DestroyFn destroy) {
+        m_commands.push_back({kind, type, entity, payload, apply, destroy});
+    }
+    
+    void ReleasePayloads(std::vector<Command>& commands);
+    
+    FrameArena m_arena;
+    std::vector<Command> m_commands;    // 记录中的命令
+    std::vector<Command> m_playback;    // 回放中的命令（容量在帧间复用）
+};
+
+} // namespace Match3::Systems
@@ -2,7 +2,6 @@
 
 #include "System.hpp"
 #include "../Components/Common.hpp"
-#include <vector>
 
 namespace Match3::Systems {
 
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Match3::Systems {
+
+/**
+ * @brief 渲染快照中的单个实体
+ */
+struct RenderItem {
+    entt::entity entity = entt::null;
+    float x = 0.0f;
+    float y = 0.0f;
+    float scale = 1.0f;
+    float rotation = 0.0f;
+    int radius = 0;
+    uint8_t type = 0;               // 宝石类型（粒子为0）
+    uint8_t r = 255;
+    uint8_t g = 255;
+    uint8_t b = 255;
+    uint8_t a = 255;
+};
+
+/**
+ * @brief 渲染快照 - 模拟线程每步发布，渲染线程在相邻两份之间插值
+ * 
+ * 数组按实体ID升序排列，便于两份快照按实体对齐。
+ */
+struct RenderSnapshot {
+    uint64_t tick = 0;              // 模拟步数
+    bool discontinuous = false;     // 重置/读档等跳变，不与上一份插值
+    std::vector<RenderItem> gems;
+    std::vector<RenderItem> particles;
+    int score = 0;
+    int moves = 0;
+    int combo = 0;
+    
+    void Clear() {
+        tick = 0;
+        discontinuous = false;
+        gems.clear();
+        particles.clear();
+        score = moves = combo = 0;
+    }
+};
+
+} // namespace Match3::Systems
@@ -1,5 +1,8 @@
 #include "RenderSystem.hpp"
 #include "Core/Logger.hpp"
+#include "Render/ResourceManager.hpp"
+#include <algorithm>
+#include <cmath>
 
 namespace Match3::Systems {
 
@@ -15,11 +18,19 @@ void RenderSystem::Update(entt::registry& registry, float deltaTime)
 {
     if (!m_enabled || !m_renderer) return;
     
+    m_stats = {};
+    
+    // 宝石和粒子共用一张精灵纹理，整批合并为一次几何提交
+    auto& batch = m_renderer->GetSpriteBatch();
+    batch.Begin();
+    
     // 先渲染宝石（背景层）
     RenderGems(registry);
     
     // 再渲染粒子（前景层）
     RenderParticles(registry);
+    
+    batch.End();
 }
 
 void RenderSystem::RenderGems(entt::registry& registry)
@@ -45,7 +56,8 @@ void RenderSystem::RenderGems(entt::registry& registry)
     // 只在第一帧打印一次
     static bool firstFrame = true;
     if (firstFrame) {
-        LOG_INFO("RenderSystem: Rendered {} gems", renderCount);
+        LOG_INFO("RenderSystem: Rendered {} gems ({} culled)", renderCount - m_stats.gemsCulled,
+                 m_stats.gemsCulled);
         firstFrame = false;
     }
 }
@@ -68,10 +80,36 @@ void RenderSystem::RenderParticles(entt::registry& registry)
     }
 }
 
+bool RenderSystem::IsVisible(const Components::Position& pos, const Components::Renderable& render) const
+{
+    const float extent = render.radius * render.scale + CULL_MARGIN;
+    return pos.x + extent >= m_viewport.x && pos.x - extent <= m_viewport.x + m_viewport.w &&
+           pos.y + extent >= m_viewport.y && pos.y - extent <= m_viewport.y + m_viewport.h;
+}
+
 void RenderSystem::RenderGem(const Components::Position& pos,
                               const Components::Renderable& render,
                               const Components::Gem& gem)
 {
+    if (!IsVisible(pos, render)) {
+        m_stats.gemsCulled++;
+        return;
+    }
+    m_stats.gemsDrawn++;
+    
+    // 优先使用预渲染精灵（主体、边框、高光已烘焙）：旋转、缩放、透明度都写进同一批顶点
+    if (auto* resources = m_renderer->GetResourceManager()) {
+        const Sprite sprite = resources->GetGemSprite(static_cast<int>(gem.type));
+        if (sprite.IsValid()) {
+            m_renderer->GetSpriteBatch().DrawRotated(sprite, pos.x, pos.y, render.radius * render.scale,
+                                                     render.rotation, 255, 255, 255, render.a);
+            return;
+        }
+    }
+    
+    // 精灵不可用时逐像素绘制（先提交已累积的批次以保持绘制顺序）
+    m_stats.fallbackDraws++;
+    m_renderer->GetSpriteBatch().Flush();
     const int centerX = static_cast<int>(pos.x);
     const int centerY = static_cast<int>(pos.y);
     const int radius = static_cast<int>(render.radius * render.scale);
@@ -91,8 +129,12 @@ void RenderSystem::RenderGem(const Components::Position& pos,
     if (render.scale > 0.5f && radius > 10) {
         const int highlightOffset = radius / Config::GEM_HIGHLIGHT_OFFSET_DIVISOR;
         const int highlightRadius = highlightOffset;
-        const int highlightX = centerX - highlightOffset;
-        const int highlightY = centerY - highlightOffset;
+        
+        // 高光偏移随旋转绕中心转动（圆形主体本身旋转不变）
+        const float cosine = std::cos(render.rotation);
+        const float sine = std::sin(render.rotation);
+        const int highlightX = centerX + static_cast<int>(std::lround(-highlightOffset * cosine + highlightOffset * sine));
+        const int highlightY = centerY + static_cast<int>(std::lround(-highlightOffset * sine - highlightOffset * cosine));
         
         const auto& highlightColor = Config::GEM_HIGHLIGHT_COLOR;
         const auto highlightAlpha = static_cast<uint8_t>(highlightColor.a * (render.a / 255.0f));
@@ -107,6 +149,24 @@ void RenderSystem::RenderGem(const Components::Position& pos,
 void RenderSystem::RenderParticle(const Components::Position& pos,
                                    const Components::Renderable& render)
 {
+    if (!IsVisible(pos, render)) {
+        m_stats.particlesCulled++;
+        return;
+    }
+    m_stats.particlesDrawn++;
+    
+    // 白色粒子精灵 + 颜色调制
+    if (auto* resources = m_renderer->GetResourceManager()) {
+        const Sprite sprite = resources->GetParticleSprite();
+        if (sprite.IsValid()) {
+            m_renderer->GetSpriteBatch().Draw(sprite, pos.x, pos.y, render.radius * render.scale,
+                                              render.r, render.g, render.b, render.a);
+            return;
+        }
+    }
+    
+    m_stats.fallbackDraws++;
+    m_renderer->GetSpriteBatch().Flush();
     const int centerX = static_cast<int>(pos.x);
     const int centerY = static_cast<int>(pos.y);
     const int radius = static_cast<int>(render.radius * render.scale);
@@ -117,4 +177,111 @@ void RenderSystem::RenderParticle(const Components::Position& pos,
                                     render.r, render.g, render.b, alpha);
 }
 
+void RenderSystem::CaptureSnapshot(entt::registry& registry, RenderSnapshot& snapshot)
+{
+    auto toItem = [](entt::entity entity, const Components::Position& pos,
+                     const Components::Renderable& render) {
+        RenderItem item;
+        item.entity = entity;
+        item.x = pos.x;
+        item.y = pos.y;
+        item.scale = render.scale;
+        item.rotation = render.rotation;
+        item.radius = render.radius;
+        item.r = render.r;
+        item.g = render.g;
+        item.b = render.b;
+        item.a = render.a;
+        return item;
+    };
+    auto byEntity = [](const RenderItem& lhs, const RenderItem& rhs) {
+        return entt::to_integral(lhs.entity) < entt::to_integral(rhs.entity);
+    };
+    
+    snapshot.gems.clear();
+    auto gemView = registry.view<Components::Position, Components::Renderable, Components::Gem>();
+    for (auto entity : gemView) {
+        const auto& gem = gemView.get<Components::Gem>(entity);
+        if (gem.IsEmpty()) continue;
+        
+        auto& item = snapshot.gems.emplace_back(toItem(entity,
+                                                       gemView.get<Components::Position>(entity),
+                                                       gemView.get<Components::Renderable>(entity)));
+        item.type = static_cast<uint8_t>(gem.type);
+    }
+    std::sort(snapshot.gems.begin(), snapshot.gems.end(), byEntity);
+    
+    snapshot.particles.clear();
+    auto particleView = registry.view<Components::Position, Components::Renderable, Components::Particle>();
+    for (auto entity : particleView) {
+        snapshot.particles.push_back(toItem(entity,
+                                            particleView.get<Components::Position>(entity),
+                                            particleView.get<Components::Renderable>(entity)));
+    }
+    std::sort(snapshot.particles.begin(), snapshot.particles.end(), byEntity);
+}
+
+template<typename DrawFn>
+void RenderSystem::RenderInterpolatedItems(const std::vector<RenderItem>& previous,
+                                           const std::vector<RenderItem>& current,
+                                           float alpha, DrawFn&& draw)
+{
+    auto lerp = [alpha](float a, float b) { return a + (b - a) * alpha; };
+    
+    // 两份快照都按实体升序，双指针对齐
+    auto prevIt = previous.begin();
+    for (const auto& cur : current) {
+        while (prevIt != previous.end() &&
+               entt::to_integral(prevIt->entity) < entt::to_integral(cur.entity)) {
+            ++prevIt;
+        }
+        
+        Components::Renderable render(cur.radius, cur.r, cur.g, cur.b, cur.a);
+        Components::Position pos(cur.x, cur.y);
+        render.scale = cur.scale;
+        render.rotation = cur.rotation;
+        
+        // 上一份快照中存在同一实体时插值，否则直接使用最新值
+        if (prevIt != previous.end() && prevIt->entity == cur.entity) {
+            pos.x = lerp(prevIt->x, cur.x);
+            pos.y = lerp(prevIt->y, cur.y);
+            render.scale = lerp(prevIt->scale, cur.scale);
+            render.rotation = lerp(prevIt->rotation, cur.rotation);
+            render.a = static_cast<uint8_t>(lerp(prevIt->a, cur.a) + 0.5f);
+        }
+        
+        // 跳过完全透明的实体
+        if (render.a == 0) continue;
+        
+        draw(pos, render, cur);
+    }
+}
+
+void RenderSystem::RenderInterpolated(const RenderSnapshot& previous, const RenderSnapshot& current, float alpha)
+{
+    if (!m_enabled || !m_renderer) return;
+    
+    // 跳变帧直接显示最新状态
+    if (current.discontinuous || previous.tick + 1 != current.tick) {
+        alpha = 1.0f;
+    }
+    
+    m_stats = {};
+    
+    auto& batch = m_renderer->GetSpriteBatch();
+    batch.Begin();
+    
+    RenderInterpolatedItems(previous.gems, current.gems, alpha,
+        [this](const Components::Position& pos, const Components::Renderable& render, const RenderItem& item) {
+            RenderGem(pos, render, Components::Gem(static_cast<Components::GemType>(item.type)));
+        });
+    
+    RenderInterpolatedItems(previous.particles, current.particles, alpha,
+        [this](const Components::Position& pos, const Components::Renderable& render, const RenderItem&) {
+            RenderParticle(pos, render);
+        });
+    
+    batch.End();
+}
+
 } // namespace Match3::Systems
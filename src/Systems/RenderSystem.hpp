@@ -4,8 +4,10 @@
 #include "../Components/Common.hpp"
 #include "../Components/Gem.hpp"
 #include "../Components/Particle.hpp"
+#include "RenderSnapshot.hpp"
 #include "Render/Renderer.hpp"
 #include "Core/Config.hpp"
+#include "Display/ViewportManager.hpp"
 
 namespace Match3::Systems {
 
@@ -16,15 +18,57 @@ namespace Match3::Systems {
  * - 渲染所有有Renderable组件的实体
  * - 区分渲染宝石、粒子等不同类型
  * - 应用缩放、旋转、透明度等视觉效果
+ * - 采集/插值渲染快照（模拟线程模式）
+ * - 剔除包围圆完全落在视口外的实体（棋盘上方待落下的宝石、飞出屏幕的粒子）
  */
 class RenderSystem : public System {
 public:
+    /**
+     * @brief 每帧绘制与剔除统计
+     */
+    struct FrameStats {
+        int gemsDrawn = 0;
+        int gemsCulled = 0;
+        int particlesDrawn = 0;
+        int particlesCulled = 0;
+        int fallbackDraws = 0; // 精灵不可用、逐像素绘制的实体
+    };
+    
+    // 包围圆额外外扩（逻辑像素），覆盖精灵的边框和抗锯齿留白
+    static constexpr float CULL_MARGIN = 4.0f;
+    
     explicit RenderSystem(Renderer* renderer);
     
     void Update(entt::registry& registry, float deltaTime) override;
     
     [[nodiscard]] const char* GetName() const override { return "RenderSystem"; }
     
+    /**
+     * @brief 采集渲染快照（在模拟线程调用）
+     * @param registry ECS注册表
+     * @param snapshot 输出，复用已有容量
+     */
+    static void CaptureSnapshot(entt::registry& registry, RenderSnapshot& snapshot);
+    
+    /**
+     * @brief 在两份快照之间插值渲染（在渲染线程调用，不访问注册表）
+     * @param previous 上一份快照
+     * @param current 最新快照
+     * @param alpha 插值系数 [0, 1]
+     */
+    void RenderInterpolated(const RenderSnapshot& previous, const RenderSnapshot& current, float alpha);
+    
+    /**
+     * @brief 设置剔除视口（场景逻辑坐标），默认为 ViewportManager 的逻辑分辨率
+     */
+    void SetViewport(const SDL_FRect& viewport) { m_viewport = viewport; }
+    [[nodiscard]] const SDL_FRect& GetViewport() const { return m_viewport; }
+    
+    /**
+     * @brief 最近一次渲染的绘制与剔除统计
+     */
+    [[nodiscard]] const FrameStats& GetFrameStats() const { return m_stats; }
+    
 private:
     // 渲染不同类型的实体
     void RenderGems(entt::registry& registry);
@@ -38,7 +82,19 @@ private:
     void RenderParticle(const Components::Position& pos,
                         const Components::Renderable& render);
     
+    // 包围圆与视口相交（宝石和粒子都按中心 + 缩放后半径近似）
+    [[nodiscard]] bool IsVisible(const Components::Position& pos, const Components::Renderable& render) const;
+    
+    // 插值渲染一组快照条目
+    template<typename DrawFn>
+    void RenderInterpolatedItems(const std::vector<RenderItem>& previous,
+                                 const std::vector<RenderItem>& current,
+                                 float alpha, DrawFn&& draw);
+    
     Renderer* m_renderer;
+    SDL_FRect m_viewport = {0.0f, 0.0f, static_cast<float>(Display::ViewportManager::GAME_WIDTH),
+                            static_cast<float>(Display::ViewportManager::GAME_HEIGHT)};
+    FrameStats m_stats;
 };
 
 } // namespace Match3::Systems
@@ -1,11 +1,13 @@
 #include "SwapSystem.hpp"
 #include "Core/Logger.hpp"
+#include <algorithm>
 #include <cmath>
 
 namespace Match3::Systems {
 
-SwapSystem::SwapSystem(BoardSystem& boardSystem, MatchDetectionSystem& matchSystem)
-    : m_boardSystem(boardSystem), m_matchSystem(matchSystem)
+SwapSystem::SwapSystem(BoardSystem& boardSystem, MatchDetectionSystem& matchSystem,
+                       AnimationLatches& latches)
+    : m_boardSystem(boardSystem), m_matchSystem(matchSystem), m_latches(latches)
 {
 }
 
@@ -13,35 +15,45 @@ void SwapSystem::Update(entt::registry& registry, float deltaTime)
 {
     if (!m_enabled) return;
     
-    // 检查待处理的交换
-    auto it = m_pendingSwaps.begin();
-    while (it != m_pendingSwaps.end()) {
-        auto& request = *it;
+    // 开始尚未播放动画的交换，完成由 OnSwapAnimationFinished 处理
+    std::erase_if(m_pendingSwaps, [&](SwapRequest& request) {
+        if (request.animationStarted) return false;
         
-        // 如果动画还未开始，开始动画
-        if (!request.animationStarted) {
-            StartSwapAnimation(registry, request);
-            request.animationStarted = true;
-        }
+        request.animationStarted = true;
+        if (StartSwapAnimation(registry, request)) return false;
         
-        // 检查动画是否完成
-        if (IsSwapAnimationComplete(registry, request)) {
-            if (request.needsRevert) {
-                // 回退无效交换
-                LOG_DEBUG("{}: Reverting invalid swap", GetName());
-                RevertSwap(registry, request);
-            }
-            
-            // 通知完成
-            if (m_swapCallback) {
-                m_swapCallback(!request.needsRevert);
-            }
-            
-            // 移除请求
-            it = m_pendingSwaps.erase(it);
-        } else {
-            ++it;
+        // 无法播放动画，直接回退
+        RevertSwap(registry, request);
+        if (m_swapCallback) {
+            m_swapCallback(false);
         }
+        return true;
+    });
+}
+
+void SwapSystem::OnSwapAnimationFinished(entt::registry& registry,
+                                         entt::entity gem1, entt::entity gem2)
+{
+    auto it = std::find_if(m_pendingSwaps.begin(), m_pendingSwaps.end(),
+        [gem1, gem2](const SwapRequest& request) {
+            return request.gem1 == gem1 && request.gem2 == gem2;
+        });
+    
+    if (it == m_pendingSwaps.end()) return;
+    
+    // 先移除请求，回调中可以发起新的交换
+    const SwapRequest request = *it;
+    m_pendingSwaps.erase(it);
+    
+    if (request.needsRevert) {
+        // 回退无效交换
+        LOG_DEBUG("{}: Reverting invalid swap", GetName());
+        RevertSwap(registry, request);
+    }
+    
+    // 通知完成
+    if (m_swapCallback) {
+        m_swapCallback(!request.needsRevert);
     }
 }
 
@@ -107,29 +119,35 @@ bool SwapSystem::IsValidSwap(entt::registry& registry,
     return !matches.empty();
 }
 
-void SwapSystem::StartSwapAnimation(entt::registry& registry, SwapRequest& request)
+bool SwapSystem::StartSwapAnimation(entt::registry& registry, SwapRequest& request)
 {
     // 获取两个宝石的位置组件
     if (!registry.valid(request.gem1) || !registry.valid(request.gem2)) {
         LOG_WARN("{}: Invalid gems in swap request", GetName());
-        return;
+        return false;
     }
     
     auto& pos1 = registry.get<Components::Position>(request.gem1);
     auto& pos2 = registry.get<Components::Position>(request.gem2);
     
+    // 两个补间动画组成一个动画组，全部完成后回调一次
+    const uint32_t group = m_latches.Create(2,
+        [this, &registry, gem1 = request.gem1, gem2 = request.gem2] {
+            OnSwapAnimationFinished(registry, gem1, gem2);
+        });
+    
     // 为两个宝石添加补间动画（使用emplace_or_replace避免崩溃）
     registry.emplace_or_replace<Components::TweenAnimation>(request.gem1,
         request.duration,
         pos1.x, pos1.y,
         pos2.x, pos2.y,
-        Components::EasingType::InOutQuad);
+        Components::EasingType::InOutQuad).group = group;
     
     registry.emplace_or_replace<Components::TweenAnimation>(request.gem2,
         request.duration,
         pos2.x, pos2.y,
         pos1.x, pos1.y,
-        Components::EasingType::InOutQuad);
+        Components::EasingType::InOutQuad).group = group;
     
     // 更新Gem状态
     if (registry.all_of<Components::Gem>(request.gem1)) {
@@ -143,6 +161,7 @@ void SwapSystem::StartSwapAnimation(entt::registry& registry, SwapRequest& reque
     }
     
     LOG_DEBUG("{}: Started swap animation", GetName());
+    return true;
 }
 
 void SwapSystem::RevertSwap(entt::registry& registry, const SwapRequest& request)
@@ -189,14 +208,4 @@ void SwapSystem::RevertSwap(entt::registry& registry, const SwapRequest& request
     LOG_DEBUG("{}: Reverted swap", GetName());
 }
 
-bool SwapSystem::IsSwapAnimationComplete(entt::registry& registry, 
-                                          const SwapRequest& request)
-{
-    // 检查两个宝石是否都没有TweenAnimation组件
-    const bool gem1Complete = !registry.all_of<Components::TweenAnimation>(request.gem1);
-    const bool gem2Complete = !registry.all_of<Components::TweenAnimation>(request.gem2);
-    
-    return gem1Complete && gem2Complete;
-}
-
 } // namespace Match3::Systems
@@ -3,6 +3,7 @@
 #include "System.hpp"
 #include "BoardSystem.hpp"
 #include "MatchDetectionSystem.hpp"
+#include "AnimationLatches.hpp"
 #include "../Components/Animation.hpp"
 #include "Core/Config.hpp"
 #include <vector>
@@ -35,10 +36,13 @@ struct SwapRequest {
  * - 验证交换有效性
  * - 触发交换动画
  * - 处理无效交换回退
+ * 
+ * 交换动画的完成由动画组闭锁通知，不再每帧轮询动画组件。
  */
 class SwapSystem : public System {
 public:
-    SwapSystem(BoardSystem& boardSystem, MatchDetectionSystem& matchSystem);
+    SwapSystem(BoardSystem& boardSystem, MatchDetectionSystem& matchSystem,
+               AnimationLatches& latches);
     
     void Update(entt::registry& registry, float deltaTime) override;
     
@@ -68,6 +72,11 @@ public:
      */
     [[nodiscard]] bool HasPendingSwaps() const { return !m_pendingSwaps.empty(); }
     
+    /**
+     * @brief 丢弃所有待处理的交换（重置棋盘时调用，不触发回调）
+     */
+    void ClearPendingSwaps() { m_pendingSwaps.clear(); }
+    
     /**
      * @brief 设置交换完成回调
      */
@@ -77,17 +86,18 @@ public:
 private:
     BoardSystem& m_boardSystem;
     MatchDetectionSystem& m_matchSystem;
+    AnimationLatches& m_latches;
     std::vector<SwapRequest> m_pendingSwaps;
     SwapCallback m_swapCallback;
     
     // 开始交换动画
-    void StartSwapAnimation(entt::registry& registry, SwapRequest& request);
+    bool StartSwapAnimation(entt::registry& registry, SwapRequest& request);
     
     // 回退交换
     void RevertSwap(entt::registry& registry, const SwapRequest& request);
     
-    // 检查动画是否完成
-    bool IsSwapAnimationComplete(entt::registry& registry, const SwapRequest& request);
+    // 交换动画完成（闭锁回调）
+    void OnSwapAnimationFinished(entt::registry& registry, entt::entity gem1, entt::entity gem2);
 };
 
 } // namespace Match3::Systems
@@ -2,6 +2,7 @@
 
 #include <entt/entt.hpp>
 #include <string>
+#include "CommandBuffer.hpp"
 
 namespace Match3::Systems {
 
@@ -56,8 +57,14 @@ public:
      */
     [[nodiscard]] virtual const char* GetName() const = 0;
     
+    /**
+     * @brief 设置结构变更命令缓冲（由SystemManager注入）
+     */
+    void SetCommandBuffer(CommandBuffer* commands) { m_commands = commands; }
+    
 protected:
     bool m_enabled = true;
+    CommandBuffer* m_commands = nullptr;    // 延迟的创建/销毁/增删组件，在同步点回放
 };
 
 } // namespace Match3::Systems
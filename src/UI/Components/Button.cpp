@@ -52,20 +52,13 @@ namespace Match3
             renderer->DrawRect(m_x + 1, m_y + 1, m_width - 2, m_height - 2);
         }
 
-        // Render text
-        if (m_fontRenderer && !m_text.empty())
+        // Render text (cached texture and metrics)
+        if (m_fontRenderer && !m_text.empty() && m_textCache.Update(m_fontRenderer, m_text, m_font))
         {
-            int textWidth = m_fontRenderer->MeasureText(m_text, m_fontId);
-            int textHeight = m_fontRenderer->GetTextHeight(m_fontId);
-            
-            if (textWidth > 0 && textHeight > 0)
-            {
-                int textX = m_x + (m_width - textWidth) / 2;
-                int textY = m_y + (m_height - textHeight) / 2;
-                
-                m_fontRenderer->RenderText(m_text, textX, textY, m_fontId,
-                                          m_textR, m_textG, m_textB, m_textA);
-            }
+            int textX = m_x + (m_width - m_textCache.GetWidth()) / 2;
+            int textY = m_y + (m_height - m_textCache.GetHeight()) / 2;
+
+            m_textCache.Render(renderer, textX, textY, m_textR, m_textG, m_textB, m_textA);
         }
     }
 
@@ -79,6 +72,7 @@ namespace Match3
             if (m_state == ButtonState::Normal)
             {
                 m_state = ButtonState::Hovered;
+                MarkDirty();
             }
             return true;
         }
@@ -87,6 +81,7 @@ namespace Match3
             if (m_state == ButtonState::Hovered)
             {
                 m_state = ButtonState::Normal;
+                MarkDirty();
             }
             return false;
         }
@@ -100,6 +95,7 @@ namespace Match3
         if (ContainsPoint(mouseX, mouseY))
         {
             m_state = ButtonState::Pressed;
+            MarkDirty();
             return true;
         }
         return false;
@@ -113,6 +109,7 @@ namespace Match3
         if (m_state == ButtonState::Pressed && ContainsPoint(mouseX, mouseY))
         {
             m_state = ButtonState::Hovered;
+            MarkDirty();
             
             // Trigger callback
             if (m_onClick)
@@ -124,40 +121,72 @@ namespace Match3
             return true;
         }
         
-        if (ContainsPoint(mouseX, mouseY))
+        const ButtonState newState = ContainsPoint(mouseX, mouseY) ? ButtonState::Hovered : ButtonState::Normal;
+        if (newState != m_state)
         {
-            m_state = ButtonState::Hovered;
-        }
-        else
-        {
-            m_state = ButtonState::Normal;
+            m_state = newState;
+            MarkDirty();
         }
         
         return false;
     }
 
+    void Button::SetText(const std::string& text)
+    {
+        if (text == m_text)
+            return;
+
+        m_text = text;
+        m_textCache.Invalidate();
+        MarkDirty();
+    }
+
+    void Button::SetFontId(const std::string& fontId)
+    {
+        if (fontId == m_fontId)
+            return;
+
+        m_fontId = fontId;
+        m_font = m_fontRenderer ? m_fontRenderer->FindFont(m_fontId) : FontHandle{};
+        m_textCache.Invalidate();
+        MarkDirty();
+    }
+
+    void Button::SetFontRenderer(FontRenderer* fontRenderer)
+    {
+        m_fontRenderer = fontRenderer;
+        m_font = m_fontRenderer ? m_fontRenderer->FindFont(m_fontId) : FontHandle{};
+        m_textCache.Invalidate();
+        MarkDirty();
+    }
+
     void Button::SetNormalColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
     {
         m_normalR = r; m_normalG = g; m_normalB = b; m_normalA = a;
+        MarkDirty();
     }
 
     void Button::SetHoverColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
     {
         m_hoverR = r; m_hoverG = g; m_hoverB = b; m_hoverA = a;
+        MarkDirty();
     }
 
     void Button::SetPressedColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
     {
         m_pressedR = r; m_pressedG = g; m_pressedB = b; m_pressedA = a;
+        MarkDirty();
     }
 
     void Button::SetTextColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
     {
         m_textR = r; m_textG = g; m_textB = b; m_textA = a;
+        MarkDirty();
     }
 
     void Button::SetBorderColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
     {
         m_borderR = r; m_borderG = g; m_borderB = b; m_borderA = a;
+        MarkDirty();
     }
 } // namespace Match3
@@ -2,6 +2,7 @@
 
 #include "UIComponent.hpp"
 #include "Render/FontRenderer.hpp"
+#include "TextCache.hpp"
 #include <string>
 #include <functional>
 
@@ -26,10 +27,10 @@ namespace Match3
         bool HandleMouseUp(int mouseX, int mouseY) override;
 
         // Text
-        void SetText(const std::string& text) { m_text = text; }
+        void SetText(const std::string& text);
         const std::string& GetText() const { return m_text; }
 
-        void SetFontId(const std::string& fontId) { m_fontId = fontId; }
+        void SetFontId(const std::string& fontId);
         const std::string& GetFontId() const { return m_fontId; }
 
         // Colors for different states
@@ -39,14 +40,14 @@ namespace Match3
         void SetTextColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255);
 
         // Border
-        void SetBorderEnabled(bool enabled) { m_borderEnabled = enabled; }
+        void SetBorderEnabled(bool enabled) { m_borderEnabled = enabled; MarkDirty(); }
         void SetBorderColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255);
 
         // Callback
         void SetOnClick(ClickCallback callback) { m_onClick = callback; }
 
         // Font renderer
-        void SetFontRenderer(FontRenderer* fontRenderer) { m_fontRenderer = fontRenderer; }
+        void SetFontRenderer(FontRenderer* fontRenderer);
 
     private:
         enum class ButtonState
@@ -58,6 +59,7 @@ namespace Match3
 
         std::string m_text;
         std::string m_fontId;
+        FontHandle m_font;            // m_fontId resolved when the font or renderer is set
         ButtonState m_state;
         
         // Colors
@@ -72,5 +74,6 @@ namespace Match3
         
         ClickCallback m_onClick;
         FontRenderer* m_fontRenderer; // Not owned
+        TextCache m_textCache;        // Rebuilt only on text or font change
     };
 } // namespace Match3
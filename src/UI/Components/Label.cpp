@@ -18,27 +18,64 @@ namespace Match3
         if (!m_visible || !m_fontRenderer || m_text.empty())
             return;
 
-        m_fontRenderer->RenderText(m_text, m_x, m_y, m_fontId, m_r, m_g, m_b, m_a, m_alignment);
+        UpdateTextCache();
+
+        int renderX = m_x;
+        switch (m_alignment)
+        {
+        case TextAlign::Center:
+            renderX = m_x - m_textCache.GetWidth() / 2;
+            break;
+        case TextAlign::Right:
+            renderX = m_x - m_textCache.GetWidth();
+            break;
+        case TextAlign::Left:
+        default:
+            break;
+        }
+
+        m_textCache.Render(renderer, renderX, m_y, m_r, m_g, m_b, m_a);
     }
 
     void Label::SetText(const std::string& text)
     {
+        if (text == m_text)
+            return;
+
         m_text = text;
-        
-        // Update width based on new text if font renderer is available
-        if (m_fontRenderer)
+        m_textCache.Invalidate();
+        UpdateTextCache();
+        MarkDirty();
+    }
+
+    void Label::SetFontId(const std::string& fontId)
+    {
+        if (fontId == m_fontId)
+            return;
+
+        m_fontId = fontId;
+        m_font = m_fontRenderer ? m_fontRenderer->FindFont(m_fontId) : FontHandle{};
+        m_textCache.Invalidate();
+        UpdateTextCache();
+        MarkDirty();
+    }
+
+    void Label::SetFontRenderer(FontRenderer* fontRenderer)
+    {
+        m_fontRenderer = fontRenderer;
+        m_font = m_fontRenderer ? m_fontRenderer->FindFont(m_fontId) : FontHandle{};
+        m_textCache.Invalidate();
+        UpdateTextCache();
+        MarkDirty();
+    }
+
+    void Label::UpdateTextCache()
+    {
+        // Update size from the cached texture if font renderer is available
+        if (m_fontRenderer && m_textCache.Update(m_fontRenderer, m_text, m_font))
         {
-            int width = m_fontRenderer->MeasureText(m_text, m_fontId);
-            if (width > 0)
-            {
-                m_width = width;
-            }
-            
-            int height = m_fontRenderer->GetTextHeight(m_fontId);
-            if (height > 0)
-            {
-                m_height = height;
-            }
+            m_width = m_textCache.GetWidth();
+            m_height = m_textCache.GetHeight();
         }
     }
 
@@ -48,5 +85,6 @@ namespace Match3
         m_g = g;
         m_b = b;
         m_a = a;
+        MarkDirty();
     }
 } // namespace Match3
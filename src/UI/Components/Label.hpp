@@ -2,12 +2,15 @@
 
 #include "UIComponent.hpp"
 #include "Render/FontRenderer.hpp"
+#include "TextCache.hpp"
 #include <string>
 
 namespace Match3
 {
     /**
      * @brief Text label UI component
+     *
+     * Keeps a retained text texture; it is only rebuilt when the text or font changes.
      */
     class Label : public UIComponent
     {
@@ -21,7 +24,7 @@ namespace Match3
         void SetText(const std::string& text);
         const std::string& GetText() const { return m_text; }
 
-        void SetFontId(const std::string& fontId) { m_fontId = fontId; }
+        void SetFontId(const std::string& fontId);
         const std::string& GetFontId() const { return m_fontId; }
 
         // Color
@@ -32,13 +35,18 @@ namespace Match3
         TextAlign GetAlignment() const { return m_alignment; }
 
         // Font renderer (must be set before rendering)
-        void SetFontRenderer(FontRenderer* fontRenderer) { m_fontRenderer = fontRenderer; }
+        void SetFontRenderer(FontRenderer* fontRenderer);
 
     private:
+        // Rebuild the cached texture if needed and refresh width/height
+        void UpdateTextCache();
+
         std::string m_text;
         std::string m_fontId;
+        FontHandle m_font;            // m_fontId resolved when the font or renderer is set
         uint8_t m_r, m_g, m_b, m_a;
         TextAlign m_alignment;
         FontRenderer* m_fontRenderer; // Not owned
+        TextCache m_textCache;
     };
 } // namespace Match3
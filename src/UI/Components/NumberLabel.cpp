@@ -0,0 +1,178 @@
+#include "NumberLabel.hpp"
+#include "Render/Renderer.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace Match3
+{
+    namespace
+    {
+        int CountCharacters(const int value)
+        {
+            int count = value < 0 ? 2 : 1;
+            for (int rest = value / 10; rest != 0; rest /= 10)
+            {
+                ++count;
+            }
+            return count;
+        }
+    }
+
+    NumberLabel::NumberLabel(int x, int y, const std::string& prefix, const std::string& fontId)
+        : UIComponent(x, y, 0, 0)
+        , m_prefix(prefix)
+        , m_fontId(fontId)
+        , m_r(255), m_g(255), m_b(255), m_a(255)
+        , m_fontRenderer(nullptr)
+        , m_hasDigits(false)
+        , m_target(0)
+        , m_displayed(0)
+        , m_rollValue(0.0)
+        , m_rollSpeed(0.0)
+        , m_rollDuration(DEFAULT_ROLL_DURATION)
+    {
+    }
+
+    void NumberLabel::Update(float deltaTime)
+    {
+        if (m_displayed == m_target)
+            return;
+
+        m_rollValue = std::min(m_rollValue + m_rollSpeed * deltaTime, static_cast<double>(m_target));
+        SetDisplayed(static_cast<int>(std::floor(m_rollValue)));
+
+        // Stay dirty for the whole roll, even on frames where the shown digits
+        // don't change, so damage tracking keeps rendering at full rate
+        MarkDirty();
+    }
+
+    void NumberLabel::Render(Renderer* renderer)
+    {
+        if (!m_visible || !m_fontRenderer)
+            return;
+
+        UpdateLayout();
+
+        int x = m_x;
+        if (!m_prefix.empty())
+        {
+            m_prefixCache.Render(renderer, x, m_y, m_r, m_g, m_b, m_a);
+            x += m_prefixCache.GetWidth();
+        }
+
+        if (!m_hasDigits)
+            return;
+
+        // Digits come out least significant first; draw them back to front
+        std::array<const Glyph*, MAX_CHARACTERS> glyphs{};
+        int count = 0;
+        unsigned int magnitude = m_displayed < 0 ? 0u - static_cast<unsigned int>(m_displayed)
+                                                 : static_cast<unsigned int>(m_displayed);
+        do
+        {
+            glyphs[count++] = &m_digits.digits[magnitude % 10];
+            magnitude /= 10;
+        }
+        while (magnitude > 0);
+
+        if (m_displayed < 0)
+        {
+            glyphs[count++] = &m_digits.minus;
+        }
+
+        // Fixed-width slots keep the number from jittering while it rolls
+        const auto advance = static_cast<float>(m_digits.advance);
+        for (int i = 0; i < count; ++i)
+        {
+            const Glyph& glyph = *glyphs[count - 1 - i];
+            if (!glyph.page)
+                continue;
+
+            const SDL_FRect dest = {
+                static_cast<float>(x) + i * advance + (advance - glyph.advance) * 0.5f + glyph.offsetX,
+                static_cast<float>(m_y), glyph.source.w, glyph.source.h
+            };
+            renderer->DrawTexture(*glyph.page, glyph.source, dest, m_r, m_g, m_b, m_a);
+        }
+    }
+
+    void NumberLabel::SetValue(int value, bool animate)
+    {
+        if (value == m_target)
+            return;
+
+        m_target = value;
+        if (!animate || m_rollDuration <= 0.0f || value < m_displayed)
+        {
+            m_rollValue = value;
+            SetDisplayed(value);
+            return;
+        }
+
+        // Re-aim from the current position so every update finishes within the roll duration
+        m_rollSpeed = (value - m_rollValue) / m_rollDuration;
+    }
+
+    void NumberLabel::SetPrefix(const std::string& prefix)
+    {
+        if (prefix == m_prefix)
+            return;
+
+        m_prefix = prefix;
+        m_prefixCache.Invalidate();
+        UpdateLayout();
+        MarkDirty();
+    }
+
+    void NumberLabel::SetColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+    {
+        m_r = r;
+        m_g = g;
+        m_b = b;
+        m_a = a;
+        MarkDirty();
+    }
+
+    void NumberLabel::SetFontRenderer(FontRenderer* fontRenderer)
+    {
+        m_fontRenderer = fontRenderer;
+        m_font = m_fontRenderer ? m_fontRenderer->FindFont(m_fontId) : FontHandle{};
+        m_hasDigits = false;
+        m_prefixCache.Invalidate();
+        UpdateLayout();
+        MarkDirty();
+    }
+
+    void NumberLabel::SetDisplayed(int value)
+    {
+        if (value == m_displayed)
+            return;
+
+        m_displayed = value;
+        UpdateLayout();
+        MarkDirty();
+    }
+
+    void NumberLabel::UpdateLayout()
+    {
+        if (!m_fontRenderer)
+            return;
+
+        if (!m_hasDigits)
+        {
+            m_hasDigits = m_fontRenderer->GetDigitGlyphs(m_font, m_digits);
+        }
+
+        int prefixWidth = 0;
+        int height = m_hasDigits ? m_digits.height : 0;
+        if (!m_prefix.empty() && m_prefixCache.Update(m_fontRenderer, m_prefix, m_font))
+        {
+            prefixWidth = m_prefixCache.GetWidth();
+            height = std::max(height, m_prefixCache.GetHeight());
+        }
+
+        m_width = prefixWidth + (m_hasDigits ? CountCharacters(m_displayed) * m_digits.advance : 0);
+        m_height = height;
+    }
+} // namespace Match3
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "UIComponent.hpp"
+#include "Render/FontRenderer.hpp"
+#include "TextCache.hpp"
+#include <string>
+
+namespace Match3
+{
+    /**
+     * @brief Numeric counter label (score, moves, combo)
+     *
+     * An optional static prefix is kept as a retained text texture; the number
+     * itself is composed every frame from the font's cached digit glyphs in
+     * fixed-width slots, one atlas quad per digit. Changing the value does no
+     * formatting, allocation or text rasterisation, so it can change every
+     * frame, e.g. while rolling up towards a new value.
+     */
+    class NumberLabel : public UIComponent
+    {
+    public:
+        static constexpr float DEFAULT_ROLL_DURATION = 0.4f; // Seconds to roll up to a new value
+        static constexpr int MAX_CHARACTERS = 11;            // "-2147483648"
+
+        NumberLabel(int x, int y, const std::string& prefix, const std::string& fontId);
+        ~NumberLabel() override = default;
+
+        void Update(float deltaTime) override;
+        void Render(Renderer* renderer) override;
+
+        /**
+         * @brief Set the target value
+         * @param value New value
+         * @param animate Roll up towards an increase; decreases always snap
+         */
+        void SetValue(int value, bool animate = true);
+        int GetValue() const { return m_target; }
+        int GetDisplayedValue() const { return m_displayed; }
+        bool IsRolling() const { return m_displayed != m_target; }
+
+        // Time to roll up to a new target, 0 to snap
+        void SetRollDuration(float seconds) { m_rollDuration = seconds; }
+
+        void SetPrefix(const std::string& prefix);
+        const std::string& GetPrefix() const { return m_prefix; }
+
+        // Color
+        void SetColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255);
+
+        // Font renderer (must be set before rendering)
+        void SetFontRenderer(FontRenderer* fontRenderer);
+
+    private:
+        // Refresh the prefix texture and digit glyphs if needed, then width/height
+        void UpdateLayout();
+
+        void SetDisplayed(int value);
+
+        std::string m_prefix;
+        std::string m_fontId;
+        FontHandle m_font;            // m_fontId resolved when the renderer is set
+        uint8_t m_r, m_g, m_b, m_a;
+        FontRenderer* m_fontRenderer; // Not owned
+        TextCache m_prefixCache;
+        FontRenderer::DigitGlyphs m_digits;
+        bool m_hasDigits;
+
+        int m_target;
+        int m_displayed;
+        double m_rollValue;  // Fractional displayed value while rolling
+        double m_rollSpeed;  // Units per second
+        float m_rollDuration;
+    };
+} // namespace Match3
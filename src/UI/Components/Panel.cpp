@@ -41,6 +41,7 @@ namespace Match3
         m_g = g;
         m_b = b;
         m_a = a;
+        MarkDirty();
     }
 
     void Panel::SetBorderColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
@@ -49,5 +50,6 @@ namespace Match3
         m_borderG = g;
         m_borderB = b;
         m_borderA = a;
+        MarkDirty();
     }
 } // namespace Match3
@@ -19,9 +19,9 @@ namespace Match3
         void SetColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255);
         
         // Border
-        void SetBorderEnabled(bool enabled) { m_borderEnabled = enabled; }
+        void SetBorderEnabled(bool enabled) { m_borderEnabled = enabled; MarkDirty(); }
         void SetBorderColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255);
-        void SetBorderWidth(int width) { m_borderWidth = width; }
+        void SetBorderWidth(int width) { m_borderWidth = width; MarkDirty(); }
 
     private:
         uint8_t m_r, m_g, m_b, m_a;
@@ -0,0 +1,27 @@
+#include "TextCache.hpp"
+#include "Render/Renderer.hpp"
+
+namespace Match3
+{
+    bool TextCache::Update(FontRenderer* fontRenderer, const std::string& text, const FontHandle font)
+    {
+        if (m_dirty && fontRenderer)
+        {
+            // Stay stale on failure (font not ready yet) so the next update retries
+            m_dirty = !fontRenderer->CreateTextTexture(text, font, m_texture);
+        }
+        return m_texture.IsValid();
+    }
+
+    void TextCache::Render(Renderer* renderer, int x, int y, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+    {
+        if (!m_texture.IsValid())
+            return;
+
+        const SDL_FRect dest = {
+            static_cast<float>(x), static_cast<float>(y),
+            static_cast<float>(m_texture.GetWidth()), static_cast<float>(m_texture.GetHeight())
+        };
+        renderer->DrawTexture(m_texture, dest, r, g, b, a);
+    }
+} // namespace Match3
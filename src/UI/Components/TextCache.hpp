@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Render/FontRenderer.hpp"
+#include "Render/Texture.hpp"
+#include <string>
+
+namespace Match3
+{
+    class Renderer;
+
+    /**
+     * @brief Retained text texture with cached metrics for UI components
+     *
+     * The text is rasterised in white once and tinted at draw time, so only
+     * text or font changes rebuild the texture; colour changes are free.
+     */
+    class TextCache
+    {
+    public:
+        /**
+         * @brief Mark the texture stale (text or font changed)
+         */
+        void Invalidate() { m_dirty = true; }
+
+        /**
+         * @brief Rebuild the texture if stale; a failed rebuild is retried next time
+         * @return true if a valid texture is available
+         */
+        bool Update(FontRenderer* fontRenderer, const std::string& text, FontHandle font);
+
+        /**
+         * @brief Draw the cached texture with its top-left corner at (x, y)
+         */
+        void Render(Renderer* renderer, int x, int y, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
+
+        int GetWidth() const { return m_texture.GetWidth(); }
+        int GetHeight() const { return m_texture.GetHeight(); }
+
+    private:
+        Texture m_texture;
+        bool m_dirty = true;
+    };
+} // namespace Match3
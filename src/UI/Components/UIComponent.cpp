@@ -10,6 +10,8 @@ namespace Match3
         , m_visible(true)
         , m_enabled(true)
         , m_zOrder(0)
+        , m_dirty(true)
+        , m_static(false)
     {
     }
 
@@ -35,12 +37,14 @@ namespace Match3
     {
         m_x = x;
         m_y = y;
+        MarkDirty();
     }
 
     void UIComponent::SetSize(int width, int height)
     {
         m_width = width;
         m_height = height;
+        MarkDirty();
     }
 
     void UIComponent::GetPosition(int& x, int& y) const
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Utils/Handle.hpp"
 #include <string>
 #include <memory>
 
@@ -7,6 +8,11 @@ namespace Match3
 {
     class Renderer;
 
+    /**
+     * @brief Component slot in a UIManager, returned by AddComponent()
+     */
+    using UiId = Handle<struct UiTag>;
+
     /**
      * @brief Base class for all UI components
      */
@@ -34,21 +40,31 @@ namespace Match3
         void GetSize(int& width, int& height) const;
 
         // Visibility and enabled state
-        void SetVisible(bool visible) { m_visible = visible; }
+        void SetVisible(bool visible) { if (m_visible != visible) { m_visible = visible; MarkDirty(); } }
         bool IsVisible() const { return m_visible; }
         
-        void SetEnabled(bool enabled) { m_enabled = enabled; }
+        void SetEnabled(bool enabled) { if (m_enabled != enabled) { m_enabled = enabled; MarkDirty(); } }
         bool IsEnabled() const { return m_enabled; }
 
         // Z-order for rendering depth
-        void SetZOrder(int zOrder) { m_zOrder = zOrder; }
+        void SetZOrder(int zOrder) { m_zOrder = zOrder; MarkDirty(); }
         int GetZOrder() const { return m_zOrder; }
 
-        // ID for component identification
+        // ID for component identification (interned by UIManager when the component is added)
         void SetId(const std::string& id) { m_id = id; }
         const std::string& GetId() const { return m_id; }
 
+        // Static components are baked into a cached background layer instead of drawn every frame
+        void SetStatic(bool isStatic) { m_static = isStatic; MarkDirty(); }
+        bool IsStatic() const { return m_static; }
+
+        // Redraw tracking: set whenever the component's appearance changes
+        bool IsDirty() const { return m_dirty; }
+        void ClearDirty() { m_dirty = false; }
+
     protected:
+        void MarkDirty() { m_dirty = true; }
+
         // Check if point is inside component bounds
         bool ContainsPoint(int x, int y) const;
 
@@ -58,5 +74,7 @@ namespace Match3
         bool m_enabled;         // Is component enabled
         int m_zOrder;           // Rendering order (higher = on top)
         std::string m_id;       // Component identifier
+        bool m_dirty;           // Appearance changed since last rendered frame
+        bool m_static;          // Rendered through UIManager::RenderStatic()
     };
 } // namespace Match3
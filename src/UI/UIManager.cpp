@@ -7,44 +7,87 @@ namespace Match3
 {
     UIManager::UIManager()
         : m_fontRenderer(nullptr)
+        , m_dirty(true)
     {
     }
 
-    void UIManager::AddComponent(std::shared_ptr<UIComponent> component)
+    UiId UIManager::AddComponent(std::shared_ptr<UIComponent> component)
     {
-        if (component)
+        if (!component)
+            return {};
+
+        const UiId id{static_cast<uint32_t>(m_slots.size())};
+        if (!component->GetId().empty())
         {
-            m_components.push_back(component);
-            SortComponents();
+            m_ids.insert_or_assign(component->GetId(), id);
         }
+        m_slots.push_back(component);
+        m_components.push_back(std::move(component));
+        SortComponents();
+        m_dirty = true;
+        return id;
+    }
+
+    UiId UIManager::FindComponent(const std::string& id) const
+    {
+        const auto it = m_ids.find(id);
+        return it != m_ids.end() ? it->second : UiId{};
+    }
+
+    void UIManager::RemoveComponent(const UiId id)
+    {
+        const std::shared_ptr<UIComponent> component = GetComponent(id);
+        if (!component)
+            return;
+
+        if (FindComponent(component->GetId()) == id)
+        {
+            m_ids.erase(component->GetId());
+        }
+        m_slots[id.index] = nullptr;
+        std::erase(m_components, component);
+        m_dirty = true;
     }
 
     void UIManager::RemoveComponent(const std::string& id)
     {
-        m_components.erase(
-            std::remove_if(m_components.begin(), m_components.end(),
-                           [&id](const std::shared_ptr<UIComponent>& comp)
-                           {
-                               return comp->GetId() == id;
-                           }),
-            m_components.end()
-        );
+        RemoveComponent(FindComponent(id));
     }
 
-    std::shared_ptr<UIComponent> UIManager::GetComponent(const std::string& id)
+    std::shared_ptr<UIComponent> UIManager::GetComponent(const UiId id) const
     {
-        const auto it = std::ranges::find_if(m_components,
-                                             [&id](const std::shared_ptr<UIComponent>& comp)
-                                             {
-                                                 return comp->GetId() == id;
-                                             });
+        return id.index < m_slots.size() ? m_slots[id.index] : nullptr;
+    }
 
-        return (it != m_components.end()) ? *it : nullptr;
+    std::shared_ptr<UIComponent> UIManager::GetComponent(const std::string& id) const
+    {
+        return GetComponent(FindComponent(id));
     }
 
     void UIManager::Clear()
     {
         m_components.clear();
+        m_slots.clear();
+        m_ids.clear();
+        m_dirty = true;
+    }
+
+    bool UIManager::IsDirty() const
+    {
+        return m_dirty || std::ranges::any_of(m_components,
+                                              [](const std::shared_ptr<UIComponent>& comp)
+                                              {
+                                                  return comp->IsDirty();
+                                              });
+    }
+
+    void UIManager::ClearDirty()
+    {
+        m_dirty = false;
+        for (auto& component : m_components)
+        {
+            component->ClearDirty();
+        }
     }
 
     void UIManager::Update(const float deltaTime)
@@ -60,16 +103,61 @@ namespace Match3
 
     void UIManager::Render(Renderer* renderer)
     {
+        // Queue the draws so panels, borders and text batch by state; Z-order becomes the layer
+        const bool wasQueueing = renderer->IsQueueing();
+        if (!wasQueueing)
+        {
+            renderer->BeginQueue();
+        }
+
         // Components are already sorted by Z-order
         for (auto& component : m_components)
         {
-            if (component->IsVisible())
+            if (component->IsStatic())
+                continue;
+
+            if (!component->IsVisible())
+            {
+                ++m_stats.hidden;
+                continue;
+            }
+
+            renderer->SetLayer(component->GetZOrder());
+            component->Render(renderer);
+            ++m_stats.rendered;
+        }
+
+        if (!wasQueueing)
+        {
+            renderer->EndQueue();
+        }
+
+        m_lastFrameStats = m_stats;
+        m_stats = {};
+    }
+
+    void UIManager::RenderStatic(Renderer* renderer)
+    {
+        for (auto& component : m_components)
+        {
+            if (component->IsVisible() && component->IsStatic())
             {
+                renderer->SetLayer(component->GetZOrder());
                 component->Render(renderer);
+                ++m_stats.staticRendered;
             }
         }
     }
 
+    bool UIManager::IsStaticDirty() const
+    {
+        return m_dirty || std::ranges::any_of(m_components,
+                                              [](const std::shared_ptr<UIComponent>& comp)
+                                              {
+                                                  return comp->IsStatic() && comp->IsDirty();
+                                              });
+    }
+
     bool UIManager::HandleMouseMove(int mouseX, int mouseY)
     {
         // Process in reverse order (top to bottom)
@@ -2,9 +2,11 @@
 
 #include "Components/UIComponent.hpp"
 #include "Render/FontRenderer.hpp"
+#include <ankerl/unordered_dense.h>
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <string>
 
 namespace Match3
 {
@@ -12,27 +14,51 @@ namespace Match3
 
     /**
      * @brief Manages UI components and event routing
+     *
+     * Every added component gets a UiId indexing a slot array. Keep the UiId
+     * (or the component pointer) for anything touched repeatedly; looking a
+     * component up by its string ID is meant for tools and one-off access.
      */
     class UIManager
     {
     public:
+        /**
+         * @brief Per-frame component counts, saved at the end of Render()
+         */
+        struct FrameStats
+        {
+            int rendered = 0;       // Dynamic components drawn by Render()
+            int staticRendered = 0; // Static components redrawn into the cached layer
+            int hidden = 0;         // Dynamic components skipped as invisible
+        };
+
         UIManager();
         ~UIManager() = default;
 
         /**
          * @brief Add a UI component
+         * @return Handle of the component, invalid if component is null
+         */
+        UiId AddComponent(std::shared_ptr<UIComponent> component);
+
+        /**
+         * @brief Resolve a component's string ID (as set before it was added)
+         * @return Invalid handle if no component has that ID
          */
-        void AddComponent(std::shared_ptr<UIComponent> component);
+        UiId FindComponent(const std::string& id) const;
 
         /**
-         * @brief Remove a UI component by ID
+         * @brief Remove a UI component
          */
+        void RemoveComponent(UiId id);
         void RemoveComponent(const std::string& id);
 
         /**
-         * @brief Get a component by ID
+         * @brief Get a component
+         * @return nullptr if the handle is invalid or the component was removed
          */
-        std::shared_ptr<UIComponent> GetComponent(const std::string& id);
+        std::shared_ptr<UIComponent> GetComponent(UiId id) const;
+        std::shared_ptr<UIComponent> GetComponent(const std::string& id) const;
 
         /**
          * @brief Clear all components
@@ -45,10 +71,20 @@ namespace Match3
         void Update(float deltaTime);
 
         /**
-         * @brief Render all components
+         * @brief Render all non-static components
          */
         void Render(Renderer* renderer);
 
+        /**
+         * @brief Render static components only (into a cached layer)
+         */
+        void RenderStatic(Renderer* renderer);
+
+        /**
+         * @brief Check whether a static component changed (cached layer is stale)
+         */
+        bool IsStaticDirty() const;
+
         /**
          * @brief Handle mouse move event
          * @return true if event was consumed by a UI component
@@ -67,6 +103,16 @@ namespace Match3
          */
         bool HandleMouseUp(int mouseX, int mouseY);
 
+        /**
+         * @brief Check whether any component changed since the last ClearDirty()
+         */
+        bool IsDirty() const;
+
+        /**
+         * @brief Clear the dirty flag of the manager and all components
+         */
+        void ClearDirty();
+
         /**
          * @brief Set font renderer for UI components
          */
@@ -77,9 +123,19 @@ namespace Match3
          */
         FontRenderer* GetFontRenderer() const { return m_fontRenderer; }
 
+        /**
+         * @brief Counts of the last frame (RenderStatic() calls since the previous Render() included)
+         */
+        const FrameStats& GetFrameStats() const { return m_lastFrameStats; }
+
     private:
-        std::vector<std::shared_ptr<UIComponent>> m_components;
+        std::vector<std::shared_ptr<UIComponent>> m_components; // Sorted by Z-order
+        std::vector<std::shared_ptr<UIComponent>> m_slots;      // Indexed by UiId, null once removed
+        ankerl::unordered_dense::map<std::string, UiId> m_ids;  // String ID -> handle
         FontRenderer* m_fontRenderer; // Not owned
+        bool m_dirty;                 // Components added or removed
+        FrameStats m_stats;
+        FrameStats m_lastFrameStats;
 
         // Sort components by Z-order
         void SortComponents();
@@ -0,0 +1,270 @@
+#pragma once
+
+#include "Easing.hpp"
+#include "Components/Animation.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * @brief 批量缓动求值 - 按缓动类型分组后对连续数组求值
+ *
+ * 逐元素 switch 会阻止向量化。这里先把同一类型的进度值收集到连续数组中，
+ * 每种类型只 switch 一次，然后在无分支的紧凑循环里求值（分段函数用条件选择
+ * 代替 if/else），GCC/Clang 可以将这些循环自动向量化为 SSE/NEON 指令。
+ */
+namespace Match3::Easing
+{
+    inline constexpr size_t EASING_TYPE_COUNT = static_cast<size_t>(Components::EasingType::OutBack) + 1;
+
+    /**
+     * @brief 缓动查找表 - 固定分辨率采样 + 线性插值
+     *
+     * 对 [0, 1] 做 N 等分采样（N + 1 个样本），查表时在相邻样本间线性插值。
+     * 误差上界（h = 1 / N）：
+     * - 光滑区间：h² / 8 · max|f''|
+     * - 导数不连续点：h / 4 · |Δf'|
+     *
+     * @tparam Fn 被采样的缓动函数（必须是 constexpr）
+     * @tparam N 区间数量
+     */
+    template <float (*Fn)(float), size_t N>
+    class LookupTable
+    {
+    public:
+        static_assert(N >= 2, "LookupTable needs at least two intervals");
+
+        constexpr LookupTable()
+        {
+            for (size_t i = 0; i <= N; ++i)
+            {
+                m_samples[i] = Fn(static_cast<float>(i) / static_cast<float>(N));
+            }
+        }
+
+        /**
+         * @brief 查表求值
+         * @param t 进度 [0, 1]，超出范围会被限制
+         */
+        [[nodiscard]] constexpr float operator()(float t) const
+        {
+            const float x = Clamp(t, 0.0f, 1.0f) * static_cast<float>(N);
+            const auto i = static_cast<size_t>(x);
+            const size_t i0 = i < N ? i : N - 1;
+            const float frac = x - static_cast<float>(i0);
+            return m_samples[i0] + (m_samples[i0 + 1] - m_samples[i0]) * frac;
+        }
+
+        /**
+         * @brief 批量查表
+         */
+        void Evaluate(const float* in, float* out, size_t count) const
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                out[i] = (*this)(in[i]);
+            }
+        }
+
+        static constexpr size_t RESOLUTION = N;
+
+    private:
+        std::array<float, N + 1> m_samples{};
+    };
+
+    inline constexpr size_t LUT_RESOLUTION = 1024;
+
+    /**
+     * OutBounce：三个落地点处导数跳变，最大为 |Δf'| = 8.25（t = 1 / 2.75）。
+     * 最大误差 ≤ 8.25 / (4 · 1024) + 15.125 / (8 · 1024²) ≈ 2.02e-3
+     */
+    inline constexpr LookupTable<&OutBounce, LUT_RESOLUTION> OUT_BOUNCE_LUT{};
+    inline constexpr float OUT_BOUNCE_LUT_MAX_ERROR = 2.1e-3f;
+
+    /**
+     * OutBack：处处光滑，max|f''| = 6 · 2.70158 - 2 · 1.70158 ≈ 12.8（t = 0）。
+     * 最大误差 ≤ 12.8 / (8 · 1024²) ≈ 1.5e-6（再加上 float 舍入误差）
+     */
+    inline constexpr LookupTable<&OutBack, LUT_RESOLUTION> OUT_BACK_LUT{};
+    inline constexpr float OUT_BACK_LUT_MAX_ERROR = 2.5e-6f;
+
+    // ========== 无分支批量内核 ==========
+
+    template <float (*Fn)(float)>
+    inline void EvaluateBranchless(const float* in, float* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = Fn(in[i]);
+        }
+    }
+
+    inline void OutBounceBranchless(const float* in, float* out, size_t count)
+    {
+        constexpr float n1 = 7.5625f;
+        constexpr float d1 = 2.75f;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float t = in[i];
+            const float t1 = t - 1.5f / d1;
+            const float t2 = t - 2.25f / d1;
+            const float t3 = t - 2.625f / d1;
+
+            const float a = n1 * t * t;
+            const float b = n1 * t1 * t1 + 0.75f;
+            const float c = n1 * t2 * t2 + 0.9375f;
+            const float d = n1 * t3 * t3 + 0.984375f;
+
+            const float cd = t < 2.5f / d1 ? c : d;
+            const float bcd = t < 2.0f / d1 ? b : cd;
+            out[i] = t < 1.0f / d1 ? a : bcd;
+        }
+    }
+
+    /**
+     * @brief 对同一缓动类型的连续进度数组求值
+     * @param type 缓动类型
+     * @param in 输入进度数组
+     * @param out 输出数组（可以与 in 相同）
+     * @param count 元素数量
+     * @param useLookupTables 是否对开销较大的曲线使用查找表
+     */
+    inline void Evaluate(Components::EasingType type, const float* in, float* out, size_t count,
+                         bool useLookupTables = false)
+    {
+        using Components::EasingType;
+
+        switch (type)
+        {
+        case EasingType::Linear:
+            EvaluateBranchless<&Linear>(in, out, count);
+            break;
+        case EasingType::InQuad:
+            EvaluateBranchless<&InQuad>(in, out, count);
+            break;
+        case EasingType::OutQuad:
+            EvaluateBranchless<&OutQuad>(in, out, count);
+            break;
+        case EasingType::InOutQuad:
+            EvaluateBranchless<&InOutQuad>(in, out, count);
+            break;
+        case EasingType::InCubic:
+            EvaluateBranchless<&InCubic>(in, out, count);
+            break;
+        case EasingType::OutCubic:
+            EvaluateBranchless<&OutCubic>(in, out, count);
+            break;
+        case EasingType::InOutCubic:
+            EvaluateBranchless<&InOutCubic>(in, out, count);
+            break;
+        case EasingType::OutBounce:
+            if (useLookupTables)
+            {
+                OUT_BOUNCE_LUT.Evaluate(in, out, count);
+            }
+            else
+            {
+                OutBounceBranchless(in, out, count);
+            }
+            break;
+        case EasingType::OutBack:
+            if (useLookupTables)
+            {
+                OUT_BACK_LUT.Evaluate(in, out, count);
+            }
+            else
+            {
+                EvaluateBranchless<&OutBack>(in, out, count);
+            }
+            break;
+        default:
+            EvaluateBranchless<&Linear>(in, out, count);
+            break;
+        }
+    }
+
+    /**
+     * @brief 缓动批处理器 - 收集一帧内的所有进度值，按类型分桶后统一求值
+     *
+     * 用法：Clear() → 多次 Add() → Evaluate() → 用 Add() 返回的槽位 Get() 结果。
+     * 内部缓冲区在帧间复用，稳定后不再分配内存。
+     */
+    class EasingBatch
+    {
+    public:
+        /**
+         * @brief 结果槽位
+         */
+        struct Slot
+        {
+            Components::EasingType type;
+            uint32_t index;
+        };
+
+        /**
+         * @brief 清空所有桶（保留容量）
+         */
+        void Clear()
+        {
+            for (auto& bucket : m_buckets)
+            {
+                bucket.values.clear();
+            }
+        }
+
+        /**
+         * @brief 添加一个待求值的进度
+         * @param type 缓动类型
+         * @param t 进度 [0, 1]
+         * @return 结果槽位
+         */
+        Slot Add(Components::EasingType type, float t)
+        {
+            auto& bucket = m_buckets[BucketIndex(type)];
+            bucket.values.push_back(t);
+            return {type, static_cast<uint32_t>(bucket.values.size() - 1)};
+        }
+
+        /**
+         * @brief 按桶批量求值（原地覆盖）
+         * @param useLookupTables 是否对开销较大的曲线使用查找表
+         */
+        void Evaluate(bool useLookupTables)
+        {
+            for (size_t i = 0; i < m_buckets.size(); ++i)
+            {
+                auto& values = m_buckets[i].values;
+                if (!values.empty())
+                {
+                    Easing::Evaluate(static_cast<Components::EasingType>(i),
+                                     values.data(), values.data(), values.size(), useLookupTables);
+                }
+            }
+        }
+
+        /**
+         * @brief 获取求值结果（必须在 Evaluate() 之后调用）
+         */
+        [[nodiscard]] float Get(Slot slot) const
+        {
+            return m_buckets[BucketIndex(slot.type)].values[slot.index];
+        }
+
+    private:
+        struct Bucket
+        {
+            std::vector<float> values;
+        };
+
+        static size_t BucketIndex(Components::EasingType type)
+        {
+            const auto index = static_cast<size_t>(type);
+            return index < EASING_TYPE_COUNT ? index : 0;
+        }
+
+        std::array<Bucket, EASING_TYPE_COUNT> m_buckets;
+    };
+} // namespace Match3::Easing
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+/**
+ * @brief 帧内存池 - 只分配、整体重置的线性分配器
+ *
+ * 内存块在 Reset() 后保留复用，稳定运行时每帧不再向系统申请内存。
+ * 不调用析构函数，持有非平凡类型的调用方需要自行析构。
+ */
+namespace Match3
+{
+    class FrameArena
+    {
+    public:
+        explicit FrameArena(size_t blockSize = DEFAULT_BLOCK_SIZE)
+            : m_blockSize(blockSize)
+        {
+        }
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /**
+         * @brief 分配一段对齐的内存
+         * @param size 字节数
+         * @param alignment 对齐（2 的幂）
+         */
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment)
+        {
+            while (m_current < m_blocks.size())
+            {
+                Block& block = m_blocks[m_current];
+                const auto base = reinterpret_cast<uintptr_t>(block.data.get());
+                const size_t offset = AlignUp(base + m_offset, alignment) - base;
+                if (offset + size <= block.size)
+                {
+                    m_offset = offset + size;
+                    return block.data.get() + offset;
+                }
+
+                // 当前块不够，尝试下一个已有的块
+                ++m_current;
+                m_offset = 0;
+            }
+
+            // 所有块都用完了，申请新块（超大请求单独成块）
+            const size_t blockSize = std::max(m_blockSize, size + alignment);
+            m_blocks.push_back({std::make_unique<std::byte[]>(blockSize), blockSize});
+            m_current = m_blocks.size() - 1;
+
+            const auto base = reinterpret_cast<uintptr_t>(m_blocks[m_current].data.get());
+            const size_t offset = AlignUp(base, alignment) - base;
+            m_offset = offset + size;
+            return m_blocks[m_current].data.get() + offset;
+        }
+
+        /**
+         * @brief 重置（保留已申请的内存块）
+         */
+        void Reset()
+        {
+            m_current = 0;
+            m_offset = 0;
+        }
+
+        /**
+         * @brief 获取已申请的总字节数
+         */
+        [[nodiscard]] size_t GetCapacity() const
+        {
+            size_t total = 0;
+            for (const auto& block : m_blocks)
+            {
+                total += block.size;
+            }
+            return total;
+        }
+
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 16 * 1024;
+
+    private:
+        struct Block
+        {
+            std::unique_ptr<std::byte[]> data;
+            size_t size;
+        };
+
+        static size_t AlignUp(size_t value, size_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        std::vector<Block> m_blocks;
+        size_t m_blockSize;
+        size_t m_current = 0;
+        size_t m_offset = 0;
+    };
+} // namespace Match3
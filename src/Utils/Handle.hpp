@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Match3
+{
+    /**
+     * @brief 类型化资源句柄 - 加载时由名字解析一次，之后按下标直接访问
+     *
+     * 句柄只是所属管理器内部数组的下标；Tag 区分不同资源，防止纹理句柄被
+     * 当成字体句柄使用。名字查找只留给加载和调试工具，渲染路径上只传句柄。
+     * 句柄在管理器 Clear()/Shutdown() 之前一直有效。
+     */
+    template <typename Tag>
+    struct Handle
+    {
+        static constexpr uint32_t INVALID = UINT32_MAX;
+
+        uint32_t index = INVALID;
+
+        [[nodiscard]] constexpr bool IsValid() const { return index != INVALID; }
+
+        constexpr bool operator==(const Handle&) const = default;
+    };
+} // namespace Match3
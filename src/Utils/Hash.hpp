@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief FNV-1a 64 位哈希 - 用于帧像素指纹等快速、非加密场景
+ */
+namespace Match3::Hash
+{
+    inline constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+    inline constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+    /**
+     * @brief 累加一段数据
+     * @param data 数据
+     * @param size 字节数
+     * @param hash 之前的哈希值（首次传 FNV_OFFSET_BASIS），可分段连续调用
+     */
+    inline uint64_t Fnv1a64(const void* data, size_t size, uint64_t hash = FNV_OFFSET_BASIS)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+} // namespace Match3::Hash
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+
+/**
+ * @brief 全局随机数引擎 - 游戏逻辑的所有随机数都从这里取
+ *
+ * 默认用 std::random_device 播种；无头回归测试等需要可复现结果时，
+ * 在创建棋盘之前调用 Seed() 固定种子。引擎不是线程安全的，
+ * 只应在游戏逻辑所在的线程上使用。
+ */
+namespace Match3::Random
+{
+    /**
+     * @brief 获取全局引擎
+     */
+    inline std::mt19937& Engine()
+    {
+        static std::mt19937 engine(std::random_device{}());
+        return engine;
+    }
+
+    /**
+     * @brief 固定种子（之后的随机序列可复现）
+     */
+    inline void Seed(uint32_t seed)
+    {
+        Engine().seed(seed);
+    }
+} // namespace Match3::Random
@@ -1,6 +1,8 @@
 #include "Core/Game.hpp"
 #include "Core/Config.hpp"
 #include "Core/Logger.hpp"
+#include "Core/LaunchOptions.hpp"
+#include "Utils/Random.hpp"
 
 int main(int argc, char* argv[])
 {
@@ -12,6 +14,13 @@ int main(int argc, char* argv[])
 
     LOG_INFO("=== Match-3 Game Starting ===");
 
+    // 解析启动参数
+    Match3::LaunchOptions::Parse(argc, argv);
+    if (Match3::LaunchOptions::Get().hasSeed)
+    {
+        Match3::Random::Seed(Match3::LaunchOptions::Get().seed);
+    }
+
     try
     {
         // 创建游戏实例
@@ -0,0 +1,309 @@
+/**
+ * AtlasPacker - packs sprite images into texture atlas pages
+ *
+ * Usage: AtlasPacker --out <dir> [--name <atlas>] [--page-size <px>] [--padding <px>] <images...>
+ *
+ * Every input BMP becomes a sprite named after its file stem (gem_0.bmp ->
+ * "gem_0"). Sprites are shelf-packed, tallest first, into as few pages as
+ * possible; each padding border repeats the sprite's edge pixels so scaled,
+ * filtered draws never sample a neighbour. Writes <name>_<n>.bmp pages and
+ * <name>.json metadata, read at runtime by ResourceManager::LoadAtlas().
+ */
+
+#include <SDL3/SDL.h>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using json = nlohmann::json;
+
+    constexpr int ATLAS_VERSION = 1; // Matches ResourceManager::LoadAtlas()
+
+    struct Options
+    {
+        std::string outputDirectory;
+        std::string name = "atlas";
+        int pageSize = 2048; // Safe maximum texture size on the mobile GPUs we target
+        int padding = 2;
+        std::vector<std::string> images;
+    };
+
+    struct Image
+    {
+        std::string name;
+        SDL_Surface* surface = nullptr; // RGBA32
+        int page = 0;
+        int x = 0;
+        int y = 0;
+    };
+
+    bool ParseInt(const char* text, int& value)
+    {
+        char* end = nullptr;
+        const long parsed = std::strtol(text, &end, 10);
+        if (end == text || *end != '\0' || parsed < 0 || parsed > 16384)
+        {
+            return false;
+        }
+        value = static_cast<int>(parsed);
+        return true;
+    }
+
+    bool ParseOptions(const int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+            if (arg == "--out" && hasValue)
+            {
+                options.outputDirectory = argv[++i];
+            }
+            else if (arg == "--name" && hasValue)
+            {
+                options.name = argv[++i];
+            }
+            else if (arg == "--page-size" && hasValue)
+            {
+                if (!ParseInt(argv[++i], options.pageSize) || options.pageSize == 0)
+                {
+                    std::fprintf(stderr, "AtlasPacker: invalid page size '%s'\n", argv[i]);
+                    return false;
+                }
+            }
+            else if (arg == "--padding" && hasValue)
+            {
+                if (!ParseInt(argv[++i], options.padding))
+                {
+                    std::fprintf(stderr, "AtlasPacker: invalid padding '%s'\n", argv[i]);
+                    return false;
+                }
+            }
+            else if (arg.starts_with("--"))
+            {
+                std::fprintf(stderr, "AtlasPacker: unknown or incomplete option '%s'\n", arg.c_str());
+                return false;
+            }
+            else
+            {
+                options.images.push_back(arg);
+            }
+        }
+
+        return !options.outputDirectory.empty() && !options.name.empty() && !options.images.empty();
+    }
+
+    bool LoadImage(const std::string& path, Image& image)
+    {
+        SDL_Surface* loaded = SDL_LoadBMP(path.c_str());
+        if (!loaded)
+        {
+            std::fprintf(stderr, "AtlasPacker: cannot load %s: %s\n", path.c_str(), SDL_GetError());
+            return false;
+        }
+
+        image.name = std::filesystem::path(path).stem().string();
+        image.surface = SDL_ConvertSurface(loaded, SDL_PIXELFORMAT_RGBA32);
+        SDL_DestroySurface(loaded);
+        if (!image.surface)
+        {
+            std::fprintf(stderr, "AtlasPacker: cannot convert %s: %s\n", path.c_str(), SDL_GetError());
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Shelf-pack images (already sorted tallest first) into pages.
+     * @return Used width/height of every page
+     */
+    bool Pack(std::vector<Image>& images, const Options& options, std::vector<SDL_Point>& pageSizes)
+    {
+        int page = 0, shelfX = 0, shelfY = 0, shelfHeight = 0;
+        pageSizes.assign(1, {0, 0});
+
+        for (auto& image : images)
+        {
+            const int cellWidth = image.surface->w + options.padding * 2;
+            const int cellHeight = image.surface->h + options.padding * 2;
+            if (cellWidth > options.pageSize || cellHeight > options.pageSize)
+            {
+                std::fprintf(stderr, "AtlasPacker: '%s' (%dx%d) does not fit a %d px page\n", image.name.c_str(),
+                             image.surface->w, image.surface->h, options.pageSize);
+                return false;
+            }
+
+            if (shelfX + cellWidth > options.pageSize)
+            {
+                shelfY += shelfHeight;
+                shelfX = 0;
+                shelfHeight = 0;
+            }
+            if (shelfY + cellHeight > options.pageSize)
+            {
+                ++page;
+                pageSizes.push_back({0, 0});
+                shelfX = shelfY = shelfHeight = 0;
+            }
+
+            image.page = page;
+            image.x = shelfX + options.padding;
+            image.y = shelfY + options.padding;
+
+            shelfX += cellWidth;
+            shelfHeight = std::max(shelfHeight, cellHeight);
+            pageSizes[page].x = std::max(pageSizes[page].x, shelfX);
+            pageSizes[page].y = std::max(pageSizes[page].y, shelfY + shelfHeight);
+        }
+        return true;
+    }
+
+    /**
+     * Copy an image into its page and extrude its edges into the padding.
+     */
+    void Blit(const Image& image, SDL_Surface* page, const int padding)
+    {
+        const SDL_Surface* source = image.surface;
+        for (int row = -padding; row < source->h + padding; ++row)
+        {
+            const int sourceRow = std::clamp(row, 0, source->h - 1);
+            const auto* src = static_cast<const uint8_t*>(source->pixels) + sourceRow * source->pitch;
+            auto* dst = static_cast<uint8_t*>(page->pixels) + (image.y + row) * page->pitch;
+            for (int column = -padding; column < source->w + padding; ++column)
+            {
+                const int sourceColumn = std::clamp(column, 0, source->w - 1);
+                std::memcpy(dst + (image.x + column) * 4, src + sourceColumn * 4, 4);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: AtlasPacker --out <dir> [--name <atlas>] [--page-size <px>] "
+                     "[--padding <px>] <images...>\n");
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Image> images(options.images.size());
+    bool loaded = true;
+    for (size_t i = 0; i < images.size() && loaded; ++i)
+    {
+        loaded = LoadImage(options.images[i], images[i]);
+    }
+
+    auto releaseImages = [&images]
+    {
+        for (const auto& image : images) SDL_DestroySurface(image.surface);
+    };
+    if (!loaded)
+    {
+        releaseImages();
+        return EXIT_FAILURE;
+    }
+
+    // Tallest first keeps shelves tight; ties by name so the output is reproducible
+    std::sort(images.begin(), images.end(), [](const Image& a, const Image& b)
+    {
+        return a.surface->h != b.surface->h ? a.surface->h > b.surface->h : a.name < b.name;
+    });
+    for (size_t i = 1; i < images.size(); ++i)
+    {
+        if (std::any_of(images.begin(), images.begin() + i, [&](const Image& other)
+        {
+            return other.name == images[i].name;
+        }))
+        {
+            std::fprintf(stderr, "AtlasPacker: duplicate sprite name '%s'\n", images[i].name.c_str());
+            releaseImages();
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<SDL_Point> pageSizes;
+    if (!Pack(images, options, pageSizes))
+    {
+        releaseImages();
+        return EXIT_FAILURE;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(options.outputDirectory, error);
+
+    json metadata;
+    metadata["version"] = ATLAS_VERSION;
+    metadata["pages"] = json::array();
+    metadata["sprites"] = json::array();
+
+    bool written = true;
+    for (size_t page = 0; page < pageSizes.size() && written; ++page)
+    {
+        const std::string file = options.name + "_" + std::to_string(page) + ".bmp";
+        const std::string path = (std::filesystem::path(options.outputDirectory) / file).string();
+
+        SDL_Surface* surface = SDL_CreateSurface(pageSizes[page].x, pageSizes[page].y, SDL_PIXELFORMAT_RGBA32);
+        if (!surface)
+        {
+            std::fprintf(stderr, "AtlasPacker: cannot create page %zu: %s\n", page, SDL_GetError());
+            written = false;
+            break;
+        }
+        SDL_ClearSurface(surface, 0.0f, 0.0f, 0.0f, 0.0f);
+
+        for (const auto& image : images)
+        {
+            if (image.page == static_cast<int>(page))
+            {
+                Blit(image, surface, options.padding);
+            }
+        }
+
+        written = SDL_SaveBMP(surface, path.c_str());
+        if (!written)
+        {
+            std::fprintf(stderr, "AtlasPacker: cannot write %s: %s\n", path.c_str(), SDL_GetError());
+        }
+        SDL_DestroySurface(surface);
+
+        metadata["pages"].push_back({{"file", file}, {"width", pageSizes[page].x}, {"height", pageSizes[page].y}});
+        std::printf("AtlasPacker: page %zu %dx%d -> %s\n", page, pageSizes[page].x, pageSizes[page].y, path.c_str());
+    }
+
+    for (const auto& image : images)
+    {
+        metadata["sprites"].push_back({
+            {"name", image.name}, {"page", image.page},
+            {"x", image.x}, {"y", image.y}, {"w", image.surface->w}, {"h", image.surface->h}
+        });
+    }
+    releaseImages();
+
+    if (!written)
+    {
+        return EXIT_FAILURE;
+    }
+
+    const std::string metadataPath = (std::filesystem::path(options.outputDirectory) / (options.name + ".json")).string();
+    std::ofstream file(metadataPath);
+    if (!file)
+    {
+        std::fprintf(stderr, "AtlasPacker: cannot write %s\n", metadataPath.c_str());
+        return EXIT_FAILURE;
+    }
+    file << metadata.dump(2);
+
+    std::printf("AtlasPacker: %zu sprite(s) in %zu page(s) -> %s\n", images.size(), pageSizes.size(),
+                metadataPath.c_str());
+    return EXIT_SUCCESS;
+}
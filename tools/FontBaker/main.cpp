@@ -0,0 +1,358 @@
+/**
+ * FontBaker - bakes the UI glyph subset of a TTF into a *.m3font file
+ *
+ * Usage: FontBaker --font <ttf> --out <file> --size <id>=<points> [--size ...] <sources...>
+ *
+ * Every string literal in the given C++ sources is scanned for codepoints;
+ * printable ASCII is always included so numbers and Latin text never fall
+ * back to the TTF. Each size is rasterised exactly like GlyphAtlas does at
+ * runtime and packed into one 8-bit coverage page (see Render/BakedFont.hpp).
+ */
+
+#include "Render/BakedFont.hpp"
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Match3::BakedFont;
+    using Match3::BakedGlyph;
+    using Match3::BakedKerning;
+    namespace BakedFontFormat = Match3::BakedFontFormat;
+
+    constexpr int PADDING = 1; // Matches GlyphAtlas::PADDING
+
+    struct SizeSpec
+    {
+        std::string id;
+        float points = 0.0f;
+    };
+
+    struct Options
+    {
+        std::string fontPath;
+        std::string outputPath;
+        std::vector<SizeSpec> sizes;
+        std::vector<std::string> sources;
+    };
+
+    bool ParseOptions(const int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+            if (arg == "--font" && hasValue)
+            {
+                options.fontPath = argv[++i];
+            }
+            else if (arg == "--out" && hasValue)
+            {
+                options.outputPath = argv[++i];
+            }
+            else if (arg == "--size" && hasValue)
+            {
+                const std::string spec = argv[++i];
+                const size_t separator = spec.find('=');
+                const float points = separator == std::string::npos
+                                         ? 0.0f
+                                         : std::strtof(spec.c_str() + separator + 1, nullptr);
+                if (separator == 0 || points <= 0.0f)
+                {
+                    std::fprintf(stderr, "FontBaker: invalid size '%s' (expected <id>=<points>)\n", spec.c_str());
+                    return false;
+                }
+                options.sizes.push_back({spec.substr(0, separator), points});
+            }
+            else if (arg.starts_with("--"))
+            {
+                std::fprintf(stderr, "FontBaker: unknown or incomplete option '%s'\n", arg.c_str());
+                return false;
+            }
+            else
+            {
+                options.sources.push_back(arg);
+            }
+        }
+
+        return !options.fontPath.empty() && !options.outputPath.empty() && !options.sizes.empty();
+    }
+
+    void CollectCodepoints(const std::string& literal, std::set<uint32_t>& codepoints)
+    {
+        const char* cursor = literal.c_str();
+        size_t remaining = literal.size();
+        while (remaining > 0)
+        {
+            const uint32_t codepoint = SDL_StepUTF8(&cursor, &remaining);
+            if (codepoint >= 0x20 && codepoint != 0x7F && codepoint != SDL_INVALID_UNICODE_CODEPOINT)
+            {
+                codepoints.insert(codepoint);
+            }
+        }
+    }
+
+    /**
+     * Collect the contents of every string literal, skipping comments and
+     * character literals (but not digit separators such as 4'000).
+     */
+    bool ScanSource(const std::string& path, std::set<uint32_t>& codepoints)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            std::fprintf(stderr, "FontBaker: cannot read %s\n", path.c_str());
+            return false;
+        }
+        const std::string text{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+        size_t i = 0;
+        while (i < text.size())
+        {
+            const char c = text[i];
+            const char next = i + 1 < text.size() ? text[i + 1] : '\0';
+            const char previous = i > 0 ? text[i - 1] : '\0';
+
+            if (c == '/' && next == '/')
+            {
+                i = text.find('\n', i);
+                if (i == std::string::npos) break;
+            }
+            else if (c == '/' && next == '*')
+            {
+                i = text.find("*/", i + 2);
+                if (i == std::string::npos) break;
+                i += 2;
+            }
+            else if (c == '"' && previous == 'R')
+            {
+                // Raw string: R"delim( ... )delim"
+                const size_t open = text.find('(', i);
+                if (open == std::string::npos) break;
+                const std::string terminator = ")" + text.substr(i + 1, open - i - 1) + "\"";
+                const size_t close = text.find(terminator, open);
+                if (close == std::string::npos) break;
+                CollectCodepoints(text.substr(open + 1, close - open - 1), codepoints);
+                i = close + terminator.size();
+            }
+            else if (c == '"' || (c == '\'' && !std::isalnum(static_cast<unsigned char>(previous))))
+            {
+                std::string literal;
+                ++i;
+                while (i < text.size() && text[i] != c && text[i] != '\n')
+                {
+                    // Escapes only produce ASCII that is baked anyway
+                    if (text[i] == '\\')
+                    {
+                        i += 2;
+                        continue;
+                    }
+                    literal += text[i++];
+                }
+                ++i;
+                if (c == '"')
+                {
+                    CollectCodepoints(literal, codepoints);
+                }
+            }
+            else
+            {
+                ++i;
+            }
+        }
+        return true;
+    }
+
+    bool BakeSize(TTF_Font* font, const SizeSpec& spec, const std::set<uint32_t>& codepoints, BakedFont& baked)
+    {
+        if (!TTF_SetFontSize(font, spec.points))
+        {
+            std::fprintf(stderr, "FontBaker: cannot set size %.1f: %s\n", spec.points, SDL_GetError());
+            return false;
+        }
+
+        baked.id = spec.id;
+        baked.size = spec.points;
+        baked.height = TTF_GetFontHeight(font);
+
+        struct Cell
+        {
+            SDL_Surface* surface = nullptr;
+        };
+        std::vector<Cell> cells;
+
+        // Rasterise and shelf-pack (all cells span the line height, so shelves stay tight)
+        int shelfX = 0, shelfY = 0, shelfHeight = 0, usedWidth = 0;
+        for (const uint32_t codepoint : codepoints)
+        {
+            if (!TTF_FontHasGlyph(font, codepoint))
+            {
+                std::fprintf(stderr, "FontBaker: '%s' has no glyph for U+%04X, skipped\n", spec.id.c_str(),
+                             codepoint);
+                continue;
+            }
+
+            int minX = 0, maxX = 0, minY = 0, maxY = 0, advance = 0;
+            if (!TTF_GetGlyphMetrics(font, codepoint, &minX, &maxX, &minY, &maxY, &advance))
+            {
+                continue;
+            }
+
+            BakedGlyph glyph;
+            glyph.codepoint = codepoint;
+            glyph.offsetX = static_cast<int16_t>(std::min(0, minX));
+            glyph.advance = static_cast<int16_t>(advance);
+
+            SDL_Surface* surface = nullptr;
+            if (SDL_Surface* rendered = TTF_RenderGlyph_Blended(font, codepoint, SDL_Color{255, 255, 255, 255}))
+            {
+                surface = SDL_ConvertSurface(rendered, SDL_PIXELFORMAT_ARGB8888);
+                SDL_DestroySurface(rendered);
+            }
+
+            if (surface)
+            {
+                const int cellWidth = surface->w + PADDING * 2;
+                const int cellHeight = surface->h + PADDING * 2;
+                if (shelfX + cellWidth > BakedFontFormat::MAX_PAGE_SIZE)
+                {
+                    shelfY += shelfHeight;
+                    shelfX = 0;
+                    shelfHeight = 0;
+                }
+
+                glyph.x = static_cast<uint16_t>(shelfX + PADDING);
+                glyph.y = static_cast<uint16_t>(shelfY + PADDING);
+                glyph.width = static_cast<uint16_t>(surface->w);
+                glyph.height = static_cast<uint16_t>(surface->h);
+
+                shelfX += cellWidth;
+                shelfHeight = std::max(shelfHeight, cellHeight);
+                usedWidth = std::max(usedWidth, shelfX);
+            }
+
+            baked.glyphs.push_back(glyph);
+            cells.push_back({surface});
+        }
+
+        baked.pageWidth = usedWidth;
+        baked.pageHeight = usedWidth > 0 ? shelfY + shelfHeight : 0;
+        if (baked.pageHeight > BakedFontFormat::MAX_PAGE_SIZE)
+        {
+            std::fprintf(stderr, "FontBaker: '%s' needs a %dx%d page, more than %d\n", spec.id.c_str(),
+                         baked.pageWidth, baked.pageHeight, BakedFontFormat::MAX_PAGE_SIZE);
+            for (const auto& cell : cells) SDL_DestroySurface(cell.surface);
+            return false;
+        }
+
+        // Keep only the alpha channel; colour is always white
+        baked.coverage.assign(static_cast<size_t>(baked.pageWidth) * baked.pageHeight, 0);
+        for (size_t i = 0; i < cells.size(); ++i)
+        {
+            SDL_Surface* surface = cells[i].surface;
+            if (!surface)
+                continue;
+
+            const BakedGlyph& glyph = baked.glyphs[i];
+            for (int row = 0; row < surface->h; ++row)
+            {
+                const auto* src = reinterpret_cast<const uint32_t*>(
+                    static_cast<const uint8_t*>(surface->pixels) + row * surface->pitch);
+                uint8_t* dst = &baked.coverage[static_cast<size_t>(glyph.y + row) * baked.pageWidth + glyph.x];
+                for (int column = 0; column < surface->w; ++column)
+                {
+                    dst[column] = static_cast<uint8_t>(src[column] >> 24);
+                }
+            }
+            SDL_DestroySurface(surface);
+        }
+
+        for (const auto& first : baked.glyphs)
+        {
+            for (const auto& second : baked.glyphs)
+            {
+                int kerning = 0;
+                if (TTF_GetGlyphKerning(font, first.codepoint, second.codepoint, &kerning) && kerning != 0)
+                {
+                    baked.kerning.push_back({first.codepoint, second.codepoint, static_cast<int16_t>(kerning)});
+                }
+            }
+        }
+
+        std::printf("FontBaker: '%s' %.0fpt - %zu glyphs, %zu kerning pairs, %dx%d page\n", spec.id.c_str(),
+                    spec.points, baked.glyphs.size(), baked.kerning.size(), baked.pageWidth, baked.pageHeight);
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        std::fprintf(stderr,
+                     "Usage: FontBaker --font <ttf> --out <file> --size <id>=<points> [--size ...] <sources...>\n");
+        return EXIT_FAILURE;
+    }
+
+    std::set<uint32_t> codepoints;
+    for (uint32_t codepoint = 0x20; codepoint < 0x7F; ++codepoint)
+    {
+        codepoints.insert(codepoint);
+    }
+    for (const auto& source : options.sources)
+    {
+        if (!ScanSource(source, codepoints))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!TTF_Init())
+    {
+        std::fprintf(stderr, "FontBaker: TTF_Init failed: %s\n", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+
+    TTF_Font* font = TTF_OpenFont(options.fontPath.c_str(), options.sizes.front().points);
+    if (!font)
+    {
+        std::fprintf(stderr, "FontBaker: cannot open %s: %s\n", options.fontPath.c_str(), SDL_GetError());
+        TTF_Quit();
+        return EXIT_FAILURE;
+    }
+
+    std::vector<BakedFont> fonts(options.sizes.size());
+    bool baked = true;
+    for (size_t i = 0; i < options.sizes.size() && baked; ++i)
+    {
+        baked = BakeSize(font, options.sizes[i], codepoints, fonts[i]);
+    }
+
+    TTF_CloseFont(font);
+    TTF_Quit();
+    if (!baked)
+    {
+        return EXIT_FAILURE;
+    }
+
+    const std::vector<uint8_t> data = BakedFontFormat::Write(fonts);
+    if (!SDL_SaveFile(options.outputPath.c_str(), data.data(), data.size()))
+    {
+        std::fprintf(stderr, "FontBaker: cannot write %s: %s\n", options.outputPath.c_str(), SDL_GetError());
+        return EXIT_FAILURE;
+    }
+
+    std::printf("FontBaker: %zu codepoints from %zu source(s) -> %s (%zu KB)\n", codepoints.size(),
+                options.sources.size(), options.outputPath.c_str(), data.size() / 1024);
+    return EXIT_SUCCESS;
+}